@@ -14,9 +14,16 @@ concept BitManipulable = BitAnalyzable<T> && BitCopyable<T> && requires(T t, con
     { t.ShiftRight(positions) } -> std::same_as<void>;
     { t.RotateLeft(positions) } -> std::same_as<void>;
     { t.RotateRight(positions) } -> std::same_as<void>;
+
+    // Shifting and rotation confined to [offset, offset + bitWidth)
+    { t.ShiftRangeLeft(offset, bitWidth, positions) } -> std::same_as<void>;
+    { t.ShiftRangeRight(offset, bitWidth, positions) } -> std::same_as<void>;
+    { t.RotateRangeLeft(offset, bitWidth, positions) } -> std::same_as<void>;
+    { t.RotateRangeRight(offset, bitWidth, positions) } -> std::same_as<void>;
     
     // Bit reversal
     { t.ReverseBits() } -> std::same_as<void>;
+    { t.ReverseBitRange(offset, bitWidth) } -> std::same_as<void>;
     { t.ReverseBytes() } -> std::same_as<void>;
     
     // Bitwise operations
@@ -0,0 +1,15 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef CONSTANTTIMEPROVIDER_H
+#define CONSTANTTIMEPROVIDER_H
+#include <concepts>
+
+// Storage providers that ask the number types for constant-time code paths
+template<typename T>
+concept ConstantTimeProvider = requires {
+    requires T::constantTime;
+};
+
+#endif //CONSTANTTIMEPROVIDER_H
@@ -0,0 +1,18 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMBACCESSIBLE_H
+#define LIMBACCESSIBLE_H
+#include <concepts>
+#include <cstdint>
+
+template<typename T>
+concept LimbAccessible = requires(T t, const T ct, size_t bitIndex, uint64_t value, size_t bitCount) {
+    // 64-bit words at arbitrary bit positions
+    { ct.LoadLimb(bitIndex) } -> std::same_as<uint64_t>;
+    { t.StoreLimb(bitIndex, value) } -> std::same_as<void>;
+    { t.StoreLimb(bitIndex, value, bitCount) } -> std::same_as<void>;
+};
+
+#endif //LIMBACCESSIBLE_H
@@ -13,13 +13,14 @@
 #include "ByteAnalyzable.h"
 #include "ByteCopyable.h"
 #include "ByteManipulable.h"
+#include "LimbAccessible.h"
 #include <concepts>
 #include <memory>
 
 template<typename T, size_t size>
 concept Storage = BitAccessible<T> && BitAnalyzable<T> && BitCopyable<T> && 
                   BitManipulable<T> && ByteAccessible<T> && ByteAnalyzable<T> && 
-                  ByteCopyable<T> && ByteManipulable<T> && requires(T ct) {
+                  ByteCopyable<T> && ByteManipulable<T> && LimbAccessible<T> && requires(T ct) {
     // Clone functionality
     { ct.Clone() } -> std::same_as<std::unique_ptr<T>>;
     
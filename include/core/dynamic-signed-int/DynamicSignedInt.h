@@ -0,0 +1,137 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_H
+#define DYNAMICSIGNEDINT_H
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <core/limb/LimbEngine.h>
+#include <core/limb/LimbVector.h>
+#include <core/signed-int/ArbitrarySignedInt.h>
+
+/**
+ * @brief Two's complement signed integer whose bit width is chosen at run time.
+ *
+ * Arithmetic wraps modulo 2^GetBitSize() exactly like ArbitrarySignedInt and runs on the same limb
+ * kernels; division truncates toward zero. The limbs live in a LimbVector, so widths up to 512 bits stay off the heap. Operands of
+ * a binary operation must have the same width; mixing widths throws std::invalid_argument, except
+ * for == and !=, which treat values of different widths as unequal.
+ */
+class DynamicSignedInt {
+    size_t bitSize_;
+    LimbVector limbs_; // bits above bitSize_ repeat the sign bit
+
+    void Normalize(); // Sign-extend from bit bitSize_ - 1
+    void RequireSameWidth(const DynamicSignedInt& other) const;
+
+public:
+    // Constructors
+    explicit DynamicSignedInt(size_t bitSize);
+    DynamicSignedInt(const DynamicSignedInt& other) = default;
+    DynamicSignedInt(DynamicSignedInt&& other) noexcept = default;
+
+    // Constructor from integral types, truncated to bitSize bits
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T> > >
+    DynamicSignedInt(size_t bitSize, T value);
+
+    // Constructor from string with an optional sign; the value wraps modulo 2^bitSize
+    DynamicSignedInt(size_t bitSize, const std::string& str, int base = 10);
+
+    // Copy out of a fixed-width integer, limb by limb straight from its storage
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    explicit DynamicSignedInt(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value);
+
+    // Assignment operators
+    DynamicSignedInt& operator=(const DynamicSignedInt& other) = default;
+    DynamicSignedInt& operator=(DynamicSignedInt&& other) noexcept = default;
+
+    // Fixed-width conversion, written straight into the target's storage; the widths must match
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    explicit operator ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>() const;
+
+    // Width changes: sign-extends or truncates
+    DynamicSignedInt Resized(size_t bitSize) const;
+
+    // Arithmetic operators
+    DynamicSignedInt operator+(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator-(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator*(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator/(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator%(const DynamicSignedInt& other) const;
+
+    // Assignment arithmetic operators
+    DynamicSignedInt& operator+=(const DynamicSignedInt& other);
+    DynamicSignedInt& operator-=(const DynamicSignedInt& other);
+    DynamicSignedInt& operator*=(const DynamicSignedInt& other);
+    DynamicSignedInt& operator/=(const DynamicSignedInt& other);
+    DynamicSignedInt& operator%=(const DynamicSignedInt& other);
+
+    // Bitwise operators
+    DynamicSignedInt operator&(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator|(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator^(const DynamicSignedInt& other) const;
+    DynamicSignedInt operator-() const;
+    DynamicSignedInt operator~() const;
+    DynamicSignedInt operator<<(size_t shift) const;
+    DynamicSignedInt operator>>(size_t shift) const; // arithmetic
+    DynamicSignedInt& operator<<=(size_t shift);
+    DynamicSignedInt& operator>>=(size_t shift);
+
+    // Comparison operators
+    bool operator==(const DynamicSignedInt& other) const;
+    bool operator!=(const DynamicSignedInt& other) const;
+    bool operator<(const DynamicSignedInt& other) const;
+    bool operator<=(const DynamicSignedInt& other) const;
+    bool operator>(const DynamicSignedInt& other) const;
+    bool operator>=(const DynamicSignedInt& other) const;
+    std::strong_ordering operator<=>(const DynamicSignedInt& other) const;
+
+    // Division operations with both quotient and remainder
+    std::pair<DynamicSignedInt, DynamicSignedInt> DivRem(const DynamicSignedInt& other) const;
+
+    // Queries
+    size_t GetBitSize() const {
+        return bitSize_;
+    }
+    size_t GetLimbCount() const {
+        return limbs_.size();
+    }
+    const Limb* GetLimbs() const {
+        return limbs_.data();
+    }
+    bool IsZero() const;
+    bool IsNegative() const;
+    bool GetBit(size_t index) const;
+
+    // Same value as ArbitrarySignedInt::Hash for the same width
+    uint64_t Hash() const;
+
+    // String conversion
+    std::string ToString(int base = 10) const;
+    std::string ToHexString() const; // two's complement bit pattern
+
+    friend std::ostream& operator<<(std::ostream& os, const DynamicSignedInt& value) {
+        return os << value.ToString();
+    }
+};
+
+// Hash support so the type can key unordered containers
+template<>
+struct std::hash<DynamicSignedInt> {
+    size_t operator()(const DynamicSignedInt& value) const noexcept {
+        return static_cast<size_t>(value.Hash());
+    }
+};
+
+#include <core/dynamic-signed-int/impl/DynamicSignedIntImpl.h>
+
+#endif //DYNAMICSIGNEDINT_H
@@ -0,0 +1,15 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINTIMPL_H
+#define DYNAMICSIGNEDINTIMPL_H
+
+#include <core/dynamic-signed-int/impl/constructor.inl>
+#include <core/dynamic-signed-int/impl/conversions.inl>
+#include <core/dynamic-signed-int/impl/arithmetic.inl>
+#include <core/dynamic-signed-int/impl/bitwise.inl>
+#include <core/dynamic-signed-int/impl/comparison.inl>
+#include <core/dynamic-signed-int/impl/string_representation.inl>
+
+#endif //DYNAMICSIGNEDINTIMPL_H
@@ -0,0 +1,119 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_ARITHMETIC_INL
+#define DYNAMICSIGNEDINT_ARITHMETIC_INL
+
+inline DynamicSignedInt DynamicSignedInt::operator+(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicSignedInt result(bitSize_);
+    LimbAddN(result.limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    result.Normalize();
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator-(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicSignedInt result(bitSize_);
+    LimbSubN(result.limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    result.Normalize();
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator*(const DynamicSignedInt& other) const {
+    // The low half of the two's complement product is the same as the unsigned one
+    RequireSameWidth(other);
+    const size_t n = limbs_.size();
+    DynamicSignedInt result(bitSize_);
+    if (n < LimbKaratsubaThreshold) {
+        LimbMulLow(result.limbs_.data(), limbs_.data(), other.limbs_.data(), n);
+    }
+    else {
+        LimbVector product(2 * n);
+        LimbVector scratch(LimbMulScratchSize(n));
+        LimbMul(product.data(), limbs_.data(), other.limbs_.data(), n, scratch.data());
+        std::copy_n(product.data(), n, result.limbs_.data());
+    }
+    result.Normalize();
+    return result;
+}
+
+inline std::pair<DynamicSignedInt, DynamicSignedInt> DynamicSignedInt::DivRem(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    if (other.IsZero()) {
+        throw std::runtime_error("Division by zero");
+    }
+
+    // Divide the magnitudes; the quotient truncates toward zero and the remainder takes the dividend's sign
+    const size_t n = limbs_.size();
+    const bool dividendNegative = IsNegative();
+    const bool divisorNegative = other.IsNegative();
+    LimbVector dividend(limbs_);
+    LimbVector divisor(other.limbs_);
+    if (dividendNegative) {
+        LimbNeg(dividend.data(), dividend.data(), n);
+    }
+    if (divisorNegative) {
+        LimbNeg(divisor.data(), divisor.data(), n);
+    }
+    DynamicSignedInt quotient(bitSize_);
+    DynamicSignedInt remainder(bitSize_);
+    LimbVector scratch(LimbDivRemScratchSize(n, n));
+    LimbDivRem(quotient.limbs_.data(), remainder.limbs_.data(), dividend.data(), n, divisor.data(), n, scratch.data());
+    if (dividendNegative != divisorNegative) {
+        LimbNeg(quotient.limbs_.data(), quotient.limbs_.data(), n);
+    }
+    if (dividendNegative) {
+        LimbNeg(remainder.limbs_.data(), remainder.limbs_.data(), n);
+    }
+    quotient.Normalize();
+    remainder.Normalize();
+    return { std::move(quotient), std::move(remainder) };
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator/(const DynamicSignedInt& other) const {
+    return DivRem(other).first;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator%(const DynamicSignedInt& other) const {
+    return DivRem(other).second;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator-() const {
+    DynamicSignedInt result(bitSize_);
+    LimbNeg(result.limbs_.data(), limbs_.data(), limbs_.size());
+    result.Normalize();
+    return result;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator+=(const DynamicSignedInt& other) {
+    RequireSameWidth(other);
+    LimbAddN(limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    Normalize();
+    return *this;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator-=(const DynamicSignedInt& other) {
+    RequireSameWidth(other);
+    LimbSubN(limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    Normalize();
+    return *this;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator*=(const DynamicSignedInt& other) {
+    *this = *this * other;
+    return *this;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator/=(const DynamicSignedInt& other) {
+    *this = *this / other;
+    return *this;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator%=(const DynamicSignedInt& other) {
+    *this = *this % other;
+    return *this;
+}
+
+#endif //DYNAMICSIGNEDINT_ARITHMETIC_INL
@@ -0,0 +1,96 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_BITWISE_INL
+#define DYNAMICSIGNEDINT_BITWISE_INL
+
+inline DynamicSignedInt DynamicSignedInt::operator&(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicSignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] &= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator|(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicSignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] |= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator^(const DynamicSignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicSignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] ^= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator~() const {
+    DynamicSignedInt result(*this);
+    for (Limb& limb : result.limbs_) {
+        limb = ~limb;
+    }
+    result.Normalize();
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator<<(size_t shift) const {
+    DynamicSignedInt result(*this);
+    result <<= shift;
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::operator>>(size_t shift) const {
+    DynamicSignedInt result(*this);
+    result >>= shift;
+    return result;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator<<=(size_t shift) {
+    const size_t n = limbs_.size();
+    if (shift >= bitSize_) {
+        std::fill(limbs_.begin(), limbs_.end(), Limb{0});
+        return *this;
+    }
+    // Whole limbs first, then the bits within a limb
+    const size_t limbShift = shift / LimbBits;
+    if (limbShift != 0) {
+        std::copy_backward(limbs_.begin(), limbs_.end() - limbShift, limbs_.end());
+        std::fill_n(limbs_.begin(), limbShift, Limb{0});
+    }
+    if (shift % LimbBits != 0) {
+        LimbShiftLeft(limbs_.data(), limbs_.data(), n, static_cast<unsigned>(shift % LimbBits));
+    }
+    Normalize();
+    return *this;
+}
+
+inline DynamicSignedInt& DynamicSignedInt::operator>>=(size_t shift) {
+    // Arithmetic: the sign-extended limbs shift the sign in from the top
+    const size_t n = limbs_.size();
+    const Limb fill = IsNegative() ? ~Limb{0} : 0;
+    if (shift >= bitSize_) {
+        std::fill(limbs_.begin(), limbs_.end(), fill);
+        return *this;
+    }
+    const size_t limbShift = shift / LimbBits;
+    if (limbShift != 0) {
+        std::copy(limbs_.begin() + limbShift, limbs_.end(), limbs_.begin());
+        std::fill(limbs_.end() - limbShift, limbs_.end(), fill);
+    }
+    if (shift % LimbBits != 0) {
+        const unsigned bits = static_cast<unsigned>(shift % LimbBits);
+        LimbShiftRight(limbs_.data(), limbs_.data(), n, bits);
+        limbs_[n - 1] |= fill << (LimbBits - bits);
+    }
+    return *this;
+}
+
+#endif //DYNAMICSIGNEDINT_BITWISE_INL
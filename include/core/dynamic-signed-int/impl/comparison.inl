@@ -0,0 +1,66 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_COMPARISON_INL
+#define DYNAMICSIGNEDINT_COMPARISON_INL
+
+inline bool DynamicSignedInt::operator==(const DynamicSignedInt& other) const {
+    // Values of different widths are simply unequal, so mixed widths can share a hash table
+    return bitSize_ == other.bitSize_ && std::equal(limbs_.begin(), limbs_.end(), other.limbs_.begin());
+}
+
+inline bool DynamicSignedInt::operator!=(const DynamicSignedInt& other) const {
+    return !(*this == other);
+}
+
+inline bool DynamicSignedInt::operator<(const DynamicSignedInt& other) const {
+    return (*this <=> other) < 0;
+}
+
+inline bool DynamicSignedInt::operator<=(const DynamicSignedInt& other) const {
+    return (*this <=> other) <= 0;
+}
+
+inline bool DynamicSignedInt::operator>(const DynamicSignedInt& other) const {
+    return (*this <=> other) > 0;
+}
+
+inline bool DynamicSignedInt::operator>=(const DynamicSignedInt& other) const {
+    return (*this <=> other) >= 0;
+}
+
+inline std::strong_ordering DynamicSignedInt::operator<=>(const DynamicSignedInt& other) const {
+    // The top limb is sign-extended, so flipping its top bit turns the signed order into the unsigned one
+    RequireSameWidth(other);
+    constexpr Limb signBit = Limb{1} << (LimbBits - 1);
+    const size_t top = limbs_.size() - 1;
+    if (limbs_[top] != other.limbs_[top]) {
+        return (limbs_[top] ^ signBit) <=> (other.limbs_[top] ^ signBit);
+    }
+    return LimbCompare(limbs_.data(), other.limbs_.data(), top) <=> 0;
+}
+
+inline bool DynamicSignedInt::IsZero() const {
+    return std::all_of(limbs_.begin(), limbs_.end(), [](Limb limb) { return limb == 0; });
+}
+
+inline bool DynamicSignedInt::IsNegative() const {
+    return limbs_[limbs_.size() - 1] >> (LimbBits - 1);
+}
+
+inline bool DynamicSignedInt::GetBit(size_t index) const {
+    if (index >= bitSize_) {
+        throw std::out_of_range("Bit index out of range");
+    }
+    return (limbs_[index / LimbBits] >> (index % LimbBits)) & 1;
+}
+
+inline uint64_t DynamicSignedInt::Hash() const {
+    // Hash the BitSize-bit pattern, without the sign extension, to match ArbitrarySignedInt::Hash
+    return LimbHashLimbs([this](size_t i) {
+        return limbs_[i] & LimbMask(bitSize_ - i * LimbBits);
+    }, limbs_.size());
+}
+
+#endif //DYNAMICSIGNEDINT_COMPARISON_INL
@@ -0,0 +1,58 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_CONSTRUCTOR_INL
+#define DYNAMICSIGNEDINT_CONSTRUCTOR_INL
+
+inline DynamicSignedInt::DynamicSignedInt(size_t bitSize) : bitSize_(bitSize), limbs_(LimbCountForBits(bitSize)) {
+    if (bitSize == 0) {
+        throw std::invalid_argument("Bit width must be positive");
+    }
+}
+
+template<typename T, typename>
+DynamicSignedInt::DynamicSignedInt(size_t bitSize, T value) : DynamicSignedInt(bitSize) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const UnsignedT bits = static_cast<UnsignedT>(value);
+    const Limb fill = value < 0 ? ~Limb{0} : 0;
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        limbs_[i] = i * LimbBits < sizeof(T) * 8 ? static_cast<Limb>(bits >> (i * LimbBits)) : fill;
+    }
+    if constexpr (sizeof(T) * 8 < LimbBits) {
+        limbs_[0] |= fill << (sizeof(T) * 8);
+    }
+    Normalize();
+}
+
+inline DynamicSignedInt::DynamicSignedInt(size_t bitSize, const std::string& str, int base) : DynamicSignedInt(bitSize) {
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Invalid base");
+    }
+    const bool negative = !str.empty() && str[0] == '-';
+    const size_t start = !str.empty() && (str[0] == '-' || str[0] == '+') ? 1 : 0;
+    if (!LimbFromString(limbs_.data(), limbs_.size(), std::string_view(str).substr(start), static_cast<unsigned>(base))) {
+        throw std::invalid_argument("Invalid character in string");
+    }
+    if (negative) {
+        LimbNeg(limbs_.data(), limbs_.data(), limbs_.size());
+    }
+    Normalize();
+}
+
+inline void DynamicSignedInt::Normalize() {
+    const size_t topBits = bitSize_ - (limbs_.size() - 1) * LimbBits;
+    Limb& top = limbs_[limbs_.size() - 1];
+    top &= LimbMask(topBits);
+    if ((top >> (topBits - 1)) & 1) {
+        top |= ~LimbMask(topBits);
+    }
+}
+
+inline void DynamicSignedInt::RequireSameWidth(const DynamicSignedInt& other) const {
+    if (bitSize_ != other.bitSize_) {
+        throw std::invalid_argument("Bit width mismatch");
+    }
+}
+
+#endif //DYNAMICSIGNEDINT_CONSTRUCTOR_INL
@@ -0,0 +1,35 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_CONVERSIONS_INL
+#define DYNAMICSIGNEDINT_CONVERSIONS_INL
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+DynamicSignedInt::DynamicSignedInt(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value) : DynamicSignedInt(BitSize) {
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        limbs_[i] = value.GetStorage().LoadLimb(BitOffset + i * LimbBits);
+    }
+    Normalize();
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+DynamicSignedInt::operator ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>() const {
+    if (bitSize_ != BitSize) {
+        throw std::invalid_argument("Bit width mismatch");
+    }
+    ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(limbs_.data());
+    return result;
+}
+
+inline DynamicSignedInt DynamicSignedInt::Resized(size_t bitSize) const {
+    DynamicSignedInt result(bitSize);
+    const size_t kept = std::min(limbs_.size(), result.limbs_.size());
+    std::copy_n(limbs_.data(), kept, result.limbs_.data());
+    std::fill(result.limbs_.begin() + kept, result.limbs_.end(), IsNegative() ? ~Limb{0} : 0);
+    result.Normalize();
+    return result;
+}
+
+#endif //DYNAMICSIGNEDINT_CONVERSIONS_INL
@@ -0,0 +1,29 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICSIGNEDINT_STRING_REPRESENTATION_INL
+#define DYNAMICSIGNEDINT_STRING_REPRESENTATION_INL
+
+inline std::string DynamicSignedInt::ToString(int base) const {
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Base must be between 2 and 36");
+    }
+    if (!IsNegative()) {
+        return LimbToString(limbs_.data(), limbs_.size(), static_cast<unsigned>(base));
+    }
+    LimbVector magnitude(limbs_.size());
+    LimbNeg(magnitude.data(), limbs_.data(), limbs_.size());
+    return "-" + LimbToString(magnitude.data(), magnitude.size(), static_cast<unsigned>(base));
+}
+
+inline std::string DynamicSignedInt::ToHexString() const {
+    // Only the low bitSize_ bits are printed, so the sign extension above them never shows
+    std::string result((bitSize_ + 3) / 4, '0');
+    LimbVector bits(limbs_);
+    bits[bits.size() - 1] &= LimbMask(bitSize_ - (bits.size() - 1) * LimbBits);
+    LimbToDigitsPow2(result.data(), result.size(), bits.data(), bits.size(), 4);
+    return result;
+}
+
+#endif //DYNAMICSIGNEDINT_STRING_REPRESENTATION_INL
@@ -0,0 +1,135 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_H
+#define DYNAMICUNSIGNEDINT_H
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <core/limb/LimbEngine.h>
+#include <core/limb/LimbVector.h>
+#include <core/unsigned-int/ArbitraryUnsignedInt.h>
+
+/**
+ * @brief Unsigned integer whose bit width is chosen at run time.
+ *
+ * Arithmetic wraps modulo 2^GetBitSize() exactly like ArbitraryUnsignedInt and runs on the same limb
+ * kernels. The limbs live in a LimbVector, so widths up to 512 bits stay off the heap. Operands of
+ * a binary operation must have the same width; mixing widths throws std::invalid_argument, except
+ * for == and !=, which treat values of different widths as unequal.
+ */
+class DynamicUnsignedInt {
+    size_t bitSize_;
+    LimbVector limbs_; // bits above bitSize_ are zero
+
+    void Normalize(); // Clear the bits above bitSize_
+    void RequireSameWidth(const DynamicUnsignedInt& other) const;
+
+public:
+    // Constructors
+    explicit DynamicUnsignedInt(size_t bitSize);
+    DynamicUnsignedInt(const DynamicUnsignedInt& other) = default;
+    DynamicUnsignedInt(DynamicUnsignedInt&& other) noexcept = default;
+
+    // Constructor from integral types, truncated to bitSize bits
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T> > >
+    DynamicUnsignedInt(size_t bitSize, T value);
+
+    // Constructor from string; the value wraps modulo 2^bitSize
+    DynamicUnsignedInt(size_t bitSize, const std::string& str, int base = 10);
+
+    // Copy out of a fixed-width integer, limb by limb straight from its storage
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    explicit DynamicUnsignedInt(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value);
+
+    // Assignment operators
+    DynamicUnsignedInt& operator=(const DynamicUnsignedInt& other) = default;
+    DynamicUnsignedInt& operator=(DynamicUnsignedInt&& other) noexcept = default;
+
+    // Fixed-width conversion, written straight into the target's storage; the widths must match
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    explicit operator ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>() const;
+
+    // Width changes: zero-extends or truncates
+    DynamicUnsignedInt Resized(size_t bitSize) const;
+
+    // Arithmetic operators
+    DynamicUnsignedInt operator+(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator-(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator*(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator/(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator%(const DynamicUnsignedInt& other) const;
+
+    // Assignment arithmetic operators
+    DynamicUnsignedInt& operator+=(const DynamicUnsignedInt& other);
+    DynamicUnsignedInt& operator-=(const DynamicUnsignedInt& other);
+    DynamicUnsignedInt& operator*=(const DynamicUnsignedInt& other);
+    DynamicUnsignedInt& operator/=(const DynamicUnsignedInt& other);
+    DynamicUnsignedInt& operator%=(const DynamicUnsignedInt& other);
+
+    // Bitwise operators
+    DynamicUnsignedInt operator&(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator|(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator^(const DynamicUnsignedInt& other) const;
+    DynamicUnsignedInt operator~() const;
+    DynamicUnsignedInt operator<<(size_t shift) const;
+    DynamicUnsignedInt operator>>(size_t shift) const;
+    DynamicUnsignedInt& operator<<=(size_t shift);
+    DynamicUnsignedInt& operator>>=(size_t shift);
+
+    // Comparison operators
+    bool operator==(const DynamicUnsignedInt& other) const;
+    bool operator!=(const DynamicUnsignedInt& other) const;
+    bool operator<(const DynamicUnsignedInt& other) const;
+    bool operator<=(const DynamicUnsignedInt& other) const;
+    bool operator>(const DynamicUnsignedInt& other) const;
+    bool operator>=(const DynamicUnsignedInt& other) const;
+    std::strong_ordering operator<=>(const DynamicUnsignedInt& other) const;
+
+    // Division operations with both quotient and remainder
+    std::pair<DynamicUnsignedInt, DynamicUnsignedInt> DivRem(const DynamicUnsignedInt& other) const;
+
+    // Queries
+    size_t GetBitSize() const {
+        return bitSize_;
+    }
+    size_t GetLimbCount() const {
+        return limbs_.size();
+    }
+    const Limb* GetLimbs() const {
+        return limbs_.data();
+    }
+    bool IsZero() const;
+    bool GetBit(size_t index) const;
+
+    // Same value as ArbitraryUnsignedInt::Hash for the same width
+    uint64_t Hash() const;
+
+    // String conversion
+    std::string ToString(int base = 10) const;
+    std::string ToHexString() const;
+
+    friend std::ostream& operator<<(std::ostream& os, const DynamicUnsignedInt& value) {
+        return os << value.ToString();
+    }
+};
+
+// Hash support so the type can key unordered containers
+template<>
+struct std::hash<DynamicUnsignedInt> {
+    size_t operator()(const DynamicUnsignedInt& value) const noexcept {
+        return static_cast<size_t>(value.Hash());
+    }
+};
+
+#include <core/dynamic-unsigned-int/impl/DynamicUnsignedIntImpl.h>
+
+#endif //DYNAMICUNSIGNEDINT_H
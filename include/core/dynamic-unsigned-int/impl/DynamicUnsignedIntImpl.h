@@ -0,0 +1,15 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINTIMPL_H
+#define DYNAMICUNSIGNEDINTIMPL_H
+
+#include <core/dynamic-unsigned-int/impl/constructor.inl>
+#include <core/dynamic-unsigned-int/impl/conversions.inl>
+#include <core/dynamic-unsigned-int/impl/arithmetic.inl>
+#include <core/dynamic-unsigned-int/impl/bitwise.inl>
+#include <core/dynamic-unsigned-int/impl/comparison.inl>
+#include <core/dynamic-unsigned-int/impl/string_representation.inl>
+
+#endif //DYNAMICUNSIGNEDINTIMPL_H
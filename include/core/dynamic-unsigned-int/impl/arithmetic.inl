@@ -0,0 +1,92 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_ARITHMETIC_INL
+#define DYNAMICUNSIGNEDINT_ARITHMETIC_INL
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator+(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicUnsignedInt result(bitSize_);
+    LimbAddN(result.limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    result.Normalize();
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator-(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicUnsignedInt result(bitSize_);
+    LimbSubN(result.limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    result.Normalize();
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator*(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    const size_t n = limbs_.size();
+    DynamicUnsignedInt result(bitSize_);
+    if (n < LimbKaratsubaThreshold) {
+        LimbMulLow(result.limbs_.data(), limbs_.data(), other.limbs_.data(), n);
+    }
+    else {
+        // The subquadratic tiers only produce full products
+        LimbVector product(2 * n);
+        LimbVector scratch(LimbMulScratchSize(n));
+        LimbMul(product.data(), limbs_.data(), other.limbs_.data(), n, scratch.data());
+        std::copy_n(product.data(), n, result.limbs_.data());
+    }
+    result.Normalize();
+    return result;
+}
+
+inline std::pair<DynamicUnsignedInt, DynamicUnsignedInt> DynamicUnsignedInt::DivRem(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    if (other.IsZero()) {
+        throw std::runtime_error("Division by zero");
+    }
+    const size_t n = limbs_.size();
+    DynamicUnsignedInt quotient(bitSize_);
+    DynamicUnsignedInt remainder(bitSize_);
+    LimbVector scratch(LimbDivRemScratchSize(n, n));
+    LimbDivRem(quotient.limbs_.data(), remainder.limbs_.data(), limbs_.data(), n, other.limbs_.data(), n, scratch.data());
+    return { std::move(quotient), std::move(remainder) };
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator/(const DynamicUnsignedInt& other) const {
+    return DivRem(other).first;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator%(const DynamicUnsignedInt& other) const {
+    return DivRem(other).second;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator+=(const DynamicUnsignedInt& other) {
+    RequireSameWidth(other);
+    LimbAddN(limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    Normalize();
+    return *this;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator-=(const DynamicUnsignedInt& other) {
+    RequireSameWidth(other);
+    LimbSubN(limbs_.data(), limbs_.data(), other.limbs_.data(), limbs_.size());
+    Normalize();
+    return *this;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator*=(const DynamicUnsignedInt& other) {
+    *this = *this * other;
+    return *this;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator/=(const DynamicUnsignedInt& other) {
+    *this = *this / other;
+    return *this;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator%=(const DynamicUnsignedInt& other) {
+    *this = *this % other;
+    return *this;
+}
+
+#endif //DYNAMICUNSIGNEDINT_ARITHMETIC_INL
@@ -0,0 +1,92 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_BITWISE_INL
+#define DYNAMICUNSIGNEDINT_BITWISE_INL
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator&(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicUnsignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] &= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator|(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicUnsignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] |= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator^(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    DynamicUnsignedInt result(*this);
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        result.limbs_[i] ^= other.limbs_[i];
+    }
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator~() const {
+    DynamicUnsignedInt result(*this);
+    for (Limb& limb : result.limbs_) {
+        limb = ~limb;
+    }
+    result.Normalize();
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator<<(size_t shift) const {
+    DynamicUnsignedInt result(*this);
+    result <<= shift;
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::operator>>(size_t shift) const {
+    DynamicUnsignedInt result(*this);
+    result >>= shift;
+    return result;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator<<=(size_t shift) {
+    const size_t n = limbs_.size();
+    if (shift >= bitSize_) {
+        std::fill(limbs_.begin(), limbs_.end(), Limb{0});
+        return *this;
+    }
+    // Whole limbs first, then the bits within a limb
+    const size_t limbShift = shift / LimbBits;
+    if (limbShift != 0) {
+        std::copy_backward(limbs_.begin(), limbs_.end() - limbShift, limbs_.end());
+        std::fill_n(limbs_.begin(), limbShift, Limb{0});
+    }
+    if (shift % LimbBits != 0) {
+        LimbShiftLeft(limbs_.data(), limbs_.data(), n, static_cast<unsigned>(shift % LimbBits));
+    }
+    Normalize();
+    return *this;
+}
+
+inline DynamicUnsignedInt& DynamicUnsignedInt::operator>>=(size_t shift) {
+    const size_t n = limbs_.size();
+    if (shift >= bitSize_) {
+        std::fill(limbs_.begin(), limbs_.end(), Limb{0});
+        return *this;
+    }
+    const size_t limbShift = shift / LimbBits;
+    if (limbShift != 0) {
+        std::copy(limbs_.begin() + limbShift, limbs_.end(), limbs_.begin());
+        std::fill(limbs_.end() - limbShift, limbs_.end(), Limb{0});
+    }
+    if (shift % LimbBits != 0) {
+        LimbShiftRight(limbs_.data(), limbs_.data(), n, static_cast<unsigned>(shift % LimbBits));
+    }
+    return *this;
+}
+
+#endif //DYNAMICUNSIGNEDINT_BITWISE_INL
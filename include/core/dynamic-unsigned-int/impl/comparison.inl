@@ -0,0 +1,53 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_COMPARISON_INL
+#define DYNAMICUNSIGNEDINT_COMPARISON_INL
+
+inline bool DynamicUnsignedInt::operator==(const DynamicUnsignedInt& other) const {
+    // Values of different widths are simply unequal, so mixed widths can share a hash table
+    return bitSize_ == other.bitSize_ && std::equal(limbs_.begin(), limbs_.end(), other.limbs_.begin());
+}
+
+inline bool DynamicUnsignedInt::operator!=(const DynamicUnsignedInt& other) const {
+    return !(*this == other);
+}
+
+inline bool DynamicUnsignedInt::operator<(const DynamicUnsignedInt& other) const {
+    return (*this <=> other) < 0;
+}
+
+inline bool DynamicUnsignedInt::operator<=(const DynamicUnsignedInt& other) const {
+    return (*this <=> other) <= 0;
+}
+
+inline bool DynamicUnsignedInt::operator>(const DynamicUnsignedInt& other) const {
+    return (*this <=> other) > 0;
+}
+
+inline bool DynamicUnsignedInt::operator>=(const DynamicUnsignedInt& other) const {
+    return (*this <=> other) >= 0;
+}
+
+inline std::strong_ordering DynamicUnsignedInt::operator<=>(const DynamicUnsignedInt& other) const {
+    RequireSameWidth(other);
+    return LimbCompare(limbs_.data(), other.limbs_.data(), limbs_.size()) <=> 0;
+}
+
+inline bool DynamicUnsignedInt::IsZero() const {
+    return std::all_of(limbs_.begin(), limbs_.end(), [](Limb limb) { return limb == 0; });
+}
+
+inline bool DynamicUnsignedInt::GetBit(size_t index) const {
+    if (index >= bitSize_) {
+        throw std::out_of_range("Bit index out of range");
+    }
+    return (limbs_[index / LimbBits] >> (index % LimbBits)) & 1;
+}
+
+inline uint64_t DynamicUnsignedInt::Hash() const {
+    return LimbHashLimbs([this](size_t i) { return limbs_[i]; }, limbs_.size());
+}
+
+#endif //DYNAMICUNSIGNEDINT_COMPARISON_INL
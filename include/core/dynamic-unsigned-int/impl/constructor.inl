@@ -0,0 +1,44 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_CONSTRUCTOR_INL
+#define DYNAMICUNSIGNEDINT_CONSTRUCTOR_INL
+
+inline DynamicUnsignedInt::DynamicUnsignedInt(size_t bitSize) : bitSize_(bitSize), limbs_(LimbCountForBits(bitSize)) {
+    if (bitSize == 0) {
+        throw std::invalid_argument("Bit width must be positive");
+    }
+}
+
+template<typename T, typename>
+DynamicUnsignedInt::DynamicUnsignedInt(size_t bitSize, T value) : DynamicUnsignedInt(bitSize) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const UnsignedT bits = static_cast<UnsignedT>(value);
+    for (size_t i = 0; i < limbs_.size() && i * LimbBits < sizeof(T) * 8; ++i) {
+        limbs_[i] = static_cast<Limb>(bits >> (i * LimbBits));
+    }
+    Normalize();
+}
+
+inline DynamicUnsignedInt::DynamicUnsignedInt(size_t bitSize, const std::string& str, int base) : DynamicUnsignedInt(bitSize) {
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Invalid base");
+    }
+    if (!LimbFromString(limbs_.data(), limbs_.size(), str, static_cast<unsigned>(base))) {
+        throw std::invalid_argument("Invalid character in string");
+    }
+    Normalize();
+}
+
+inline void DynamicUnsignedInt::Normalize() {
+    limbs_[limbs_.size() - 1] &= LimbMask(bitSize_ - (limbs_.size() - 1) * LimbBits);
+}
+
+inline void DynamicUnsignedInt::RequireSameWidth(const DynamicUnsignedInt& other) const {
+    if (bitSize_ != other.bitSize_) {
+        throw std::invalid_argument("Bit width mismatch");
+    }
+}
+
+#endif //DYNAMICUNSIGNEDINT_CONSTRUCTOR_INL
@@ -0,0 +1,33 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_CONVERSIONS_INL
+#define DYNAMICUNSIGNEDINT_CONVERSIONS_INL
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+DynamicUnsignedInt::DynamicUnsignedInt(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value) : DynamicUnsignedInt(BitSize) {
+    for (size_t i = 0; i < limbs_.size(); ++i) {
+        limbs_[i] = value.GetStorage().LoadLimb(BitOffset + i * LimbBits);
+    }
+    Normalize();
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+DynamicUnsignedInt::operator ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>() const {
+    if (bitSize_ != BitSize) {
+        throw std::invalid_argument("Bit width mismatch");
+    }
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(limbs_.data());
+    return result;
+}
+
+inline DynamicUnsignedInt DynamicUnsignedInt::Resized(size_t bitSize) const {
+    DynamicUnsignedInt result(bitSize);
+    std::copy_n(limbs_.data(), std::min(limbs_.size(), result.limbs_.size()), result.limbs_.data());
+    result.Normalize();
+    return result;
+}
+
+#endif //DYNAMICUNSIGNEDINT_CONVERSIONS_INL
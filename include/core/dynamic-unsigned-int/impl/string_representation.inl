@@ -0,0 +1,21 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef DYNAMICUNSIGNEDINT_STRING_REPRESENTATION_INL
+#define DYNAMICUNSIGNEDINT_STRING_REPRESENTATION_INL
+
+inline std::string DynamicUnsignedInt::ToString(int base) const {
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Base must be between 2 and 36");
+    }
+    return LimbToString(limbs_.data(), limbs_.size(), static_cast<unsigned>(base));
+}
+
+inline std::string DynamicUnsignedInt::ToHexString() const {
+    std::string result((bitSize_ + 3) / 4, '0');
+    LimbToDigitsPow2(result.data(), result.size(), limbs_.data(), limbs_.size(), 4);
+    return result;
+}
+
+#endif //DYNAMICUNSIGNEDINT_STRING_REPRESENTATION_INL
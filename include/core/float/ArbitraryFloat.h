@@ -7,19 +7,41 @@
 #include <iostream>
 #include <string>
 #include <utility>
+#include <functional>
 #include <type_traits>
+#include <algorithm>
 #include <array>
 #include <optional>
 #include <cstdint>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <limits>
 
 #include <concepts/StorageProvider.h>
+#include <core/limb/LimbEngine.h>
 
-template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 class ArbitrarySignedInt;
 
-template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 class ArbitraryUnsignedInt;
 
+// True when Native is an IEEE 754 hardware type whose little-endian encoding is exactly
+// ArbitraryFloat<ExpBits, MantissaBits>. The x87 long double stores its integer bit explicitly,
+// so it never lines up with a format that has an implicit one.
+template<typename Native, size_t ExpBits, size_t MantissaBits>
+inline constexpr bool NativeFloatMatches = std::endian::native == std::endian::little &&
+                                           std::numeric_limits<Native>::is_iec559 &&
+                                           sizeof(Native) * 8 == ExpBits + MantissaBits + 1 &&
+                                           std::numeric_limits<Native>::digits == MantissaBits + 1 &&
+                                           ExpBits < 32 && std::numeric_limits<Native>::max_exponent == (1 << (ExpBits - 1));
+
+// float or double when one has the ArbitraryFloat<ExpBits, MantissaBits> encoding, void otherwise
+template<size_t ExpBits, size_t MantissaBits>
+using NativeFloatFor = std::conditional_t<NativeFloatMatches<float, ExpBits, MantissaBits>, float,
+                                          std::conditional_t<NativeFloatMatches<double, ExpBits, MantissaBits>, double, void>>;
+
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 /**
  * Represents an arbitrary-precision floating point number with customizable
@@ -122,6 +144,8 @@ public:
     ArbitraryFloat& operator/=(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other);
     
     // ===== COMPARISON OPERATORS =====
+    // IEEE 754 semantics: +0 == -0, and a NaN compares unequal to everything, itself included. Like
+    // double, a NaN key can be inserted into an unordered container but is never found again.
     bool operator==(const ArbitraryFloat& other) const;
     bool operator!=(const ArbitraryFloat& other) const;
     bool operator<(const ArbitraryFloat& other) const;
@@ -130,6 +154,9 @@ public:
     bool operator>=(const ArbitraryFloat& other) const;
     std::partial_ordering operator<=>(const ArbitraryFloat& other) const;
 
+    // Hash consistent with operator==: +0 and -0 hash alike, and so do all NaNs
+    uint64_t Hash() const;
+
     // ===== MIXED PRECISION COMPARION OPERATORS =====
     template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
     bool operator==(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const;
@@ -326,10 +353,10 @@ public:
         return MantissaBits + 1;
     }
     static constexpr size_t ExponentBias() {
-        return (1 << (ExpBits - 1)) - 1;
+        return (size_t{1} << (ExpBits - 1)) - 1;
     }
     static constexpr size_t MaxExponent() {
-        return (1 << ExpBits) - 1;
+        return (size_t{1} << ExpBits) - 1;
     }
     static constexpr size_t MinExponent() {
         return 1 - ExponentBias();
@@ -366,10 +393,77 @@ public:
     }
 
 private:
+    // Format conversions round through the target's soft-float core
+    template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProviderType> requires StorageProvider<OtherStorageProviderType, ((OtherExpBits + OtherMantBits + 1 + 7) >> 3)>
+    friend class ArbitraryFloat;
+
     // Helper functions
     void Normalize();
     bool IsSpecialValue() const;
     static ArbitraryFloat FromComponents(bool sign, uint64_t exponent, uint64_t mantissa);
+
+    // ===== NATIVE FAST PATH =====
+    // Formats that match float or double run their arithmetic on the FPU through std::bit_cast
+    using NativeType = NativeFloatFor<ExpBits, MantissaBits>;
+    static constexpr bool HasNativeType = !std::is_void_v<NativeType>;
+
+    template<typename Native>
+    Native ToNative() const;
+    template<typename Native>
+    static ArbitraryFloat FromNative(Native value);
+
+    // ===== SOFT-FLOAT CORE =====
+    // Significands carry the implicit bit plus one bit of headroom for the rounding carry
+    static constexpr size_t SignificandLimbs = LimbCountForBits(MantissaBits + 2);
+    using Significand = std::array<Limb, SignificandLimbs>;
+
+    enum class Category { Zero, Finite, Infinite, NaN };
+
+    // An encoding read a limb at a time. Finite values are (-1)^sign * significand * 2^(exponent - MantissaBits)
+    // with bit MantissaBits of the significand set (subnormals are normalized)
+    struct Unpacked {
+        Category category;
+        bool sign;
+        int64_t exponent;
+        Significand significand;
+    };
+
+    Unpacked Unpack() const;
+    ArbitraryFloat Quieted() const;
+    static ArbitraryFloat Pack(bool sign, uint64_t biasedExponent, const Limb* mantissa);
+    static ArbitraryFloat RoundAndPack(bool sign, int64_t exponent, Limb* significand, size_t n, bool sticky);
+    static ArbitraryFloat AddOrSubtract(const ArbitraryFloat& a, const ArbitraryFloat& b, bool negateB);
+    static ArbitraryFloat Multiply(const ArbitraryFloat& a, const ArbitraryFloat& b);
+    static ArbitraryFloat Divide(const ArbitraryFloat& a, const ArbitraryFloat& b);
+    static ArbitraryFloat FusedMultiplyAdd(const ArbitraryFloat& a, const ArbitraryFloat& b, const ArbitraryFloat& c);
+
+    // ===== LOOKUP-TABLE ENGINE =====
+    // Formats of at most 12 bits decode through a table indexed by the encoding, and formats of
+    // at most 8 bits also serve + - * / from a 2^(2 * totalBits) entry table per operator (64 KiB
+    // for FP8). The tables are filled from the soft-float core on first use, so they give the same bits.
+    static constexpr bool HasDecodeTable = totalBits <= 12;
+    static constexpr bool HasBinaryTables = totalBits <= 8 && !HasNativeType;
+    static constexpr size_t DecodeTableSize = HasDecodeTable ? size_t{1} << totalBits : 0;
+    static constexpr size_t BinaryTableSize = HasBinaryTables ? size_t{1} << (2 * totalBits) : 0;
+    using Encoding = std::conditional_t<(totalBits <= 8), uint8_t, uint16_t>;
+
+    enum class TableOp { Add, Subtract, Multiply, Divide };
+
+    Encoding GetEncoding() const;
+    static ArbitraryFloat FromEncoding(Encoding encoding);
+    static const std::array<double, DecodeTableSize>& DecodeTable() requires HasDecodeTable;
+    template<TableOp Op>
+    static const std::array<Encoding, BinaryTableSize>& BinaryTable() requires HasBinaryTables;
+    template<TableOp Op>
+    static ArbitraryFloat FromBinaryTable(const ArbitraryFloat& a, const ArbitraryFloat& b) requires HasBinaryTables;
+};
+
+// Hash support so the type can key unordered containers
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+struct std::hash<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> {
+    size_t operator()(const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>& value) const noexcept {
+        return static_cast<size_t>(value.Hash());
+    }
 };
 
 #include <core/float/impl/ArbitraryFloatImpl.h>
@@ -0,0 +1,66 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYFLOATBATCH_H
+#define ARBITRARYFLOATBATCH_H
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <core/float/ArbitraryFloat.h>
+
+// ===== FORMAT CONVERSION =====
+/**
+ * @brief out[i] = float(in[i]), correctly rounded. The spans must have the same length.
+ * Float16 runs on F16C (vcvtph2ps) and BFloat16 on AVX2 when the CPU has them; other formats
+ * and other CPUs take the portable path, which gives the same bits.
+ */
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void ConvertArray(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> in, std::span<float> out);
+
+/**
+ * @brief out[i] = in[i] rounded to nearest even. The spans must have the same length.
+ * Float16 runs on F16C (vcvtps2ph) and BFloat16 on AVX2 when the CPU has them. NaNs keep the
+ * top of their payload and come out quiet, as the hardware conversions do.
+ */
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void ConvertArray(std::span<const float> in, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+// ===== ELEMENTWISE ARITHMETIC =====
+/**
+ * @brief out[i] = a[i] op b[i], bit for bit what the scalar operators return, NaN sign and payload
+ * included. All spans must have the same length, and out may be one of the inputs.
+ * Formats with up to 25 significand bits and 10 exponent bits are decoded into double lanes with
+ * shifts and masks (four at a time on AVX2), computed there and rounded back once (Float16 and BFloat16 use float lanes
+ * and the ConvertArray kernels). float and double formats and formats of 8 bits or fewer loop
+ * over the FPU and table operators. Anything wider runs the soft-float core element by element.
+ */
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Add(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Sub(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Mul(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Div(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+/**
+ * @brief out[i] = a[i] * b[i] + c[i] with a single rounding, like ArbitraryFloat::Fma.
+ * Formats that fit double lanes round the exact product plus c to odd in double before the final rounding.
+ */
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Fma(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> c, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out);
+
+#include <core/float/impl/batch_conversion.inl>
+#include <core/float/impl/batch_arithmetic.inl>
+
+#endif //ARBITRARYFLOATBATCH_H
@@ -14,8 +14,10 @@
 #include <core/float/impl/conversions.inl>
 #include <core/float/impl/constructors.inl>
 #include <core/float/impl/ieee754_queries.inl>
+#include <core/float/impl/lookup_tables.inl>
 #include <core/float/impl/next_representable.inl>
 #include <core/float/impl/rounding.inl>
+#include <core/float/impl/soft_float.inl>
 #include <core/float/impl/special_values.inl>
 #include <core/float/impl/string_representation.inl>
 #include <core/float/impl/unary_ops.inl>
@@ -6,20 +6,52 @@
 #define ARBITRARYFLOAT_ARITHMETIC_INL
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator+(const ArbitraryFloat& other) const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator+(const ArbitraryFloat& other) not implemented.");
-}
-template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator-(const ArbitraryFloat& other) const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator-(const ArbitraryFloat& other) not implemented.");
-}
-template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator*(const ArbitraryFloat& other) const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator*(const ArbitraryFloat& other) not implemented.");
-}
-template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator/(const ArbitraryFloat& other) const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator/(const ArbitraryFloat& other) not implemented.");
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator+(const ArbitraryFloat& other) const {
+    if constexpr (HasNativeType) {
+        return FromNative(ToNative<NativeType>() + other.ToNative<NativeType>());
+    }
+    else if constexpr (HasBinaryTables) {
+        return FromBinaryTable<TableOp::Add>(*this, other);
+    }
+    else {
+        return AddOrSubtract(*this, other, false);
+    }
+}
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator-(const ArbitraryFloat& other) const {
+    if constexpr (HasNativeType) {
+        return FromNative(ToNative<NativeType>() - other.ToNative<NativeType>());
+    }
+    else if constexpr (HasBinaryTables) {
+        return FromBinaryTable<TableOp::Subtract>(*this, other);
+    }
+    else {
+        return AddOrSubtract(*this, other, true);
+    }
+}
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator*(const ArbitraryFloat& other) const {
+    if constexpr (HasNativeType) {
+        return FromNative(ToNative<NativeType>() * other.ToNative<NativeType>());
+    }
+    else if constexpr (HasBinaryTables) {
+        return FromBinaryTable<TableOp::Multiply>(*this, other);
+    }
+    else {
+        return Multiply(*this, other);
+    }
+}
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator/(const ArbitraryFloat& other) const {
+    if constexpr (HasNativeType) {
+        return FromNative(ToNative<NativeType>() / other.ToNative<NativeType>());
+    }
+    else if constexpr (HasBinaryTables) {
+        return FromBinaryTable<TableOp::Divide>(*this, other);
+    }
+    else {
+        return Divide(*this, other);
+    }
 }
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
@@ -41,15 +73,23 @@ auto ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator/(const
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator+=(const ArbitraryFloat& other) {
+    *this = *this + other;
+    return *this;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator-=(const ArbitraryFloat& other) {
+    *this = *this - other;
+    return *this;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator*=(const ArbitraryFloat& other) {
+    *this = *this * other;
+    return *this;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator/=(const ArbitraryFloat& other) {
+    *this = *this / other;
+    return *this;
 }
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
@@ -0,0 +1,453 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYFLOAT_BATCH_ARITHMETIC_INL
+#define ARBITRARYFLOAT_BATCH_ARITHMETIC_INL
+
+// Elements are decoded into lane buffers this many at a time
+inline constexpr size_t FloatBatchChunk = 256;
+
+enum class FloatBatchOp { Add, Subtract, Multiply, Divide };
+
+template<FloatBatchOp Op, typename Lane>
+Lane FloatBatchApply(Lane a, Lane b) {
+    if constexpr (Op == FloatBatchOp::Add) {
+        return a + b;
+    }
+    else if constexpr (Op == FloatBatchOp::Subtract) {
+        return a - b;
+    }
+    else if constexpr (Op == FloatBatchOp::Multiply) {
+        return a * b;
+    }
+    else {
+        return a / b;
+    }
+}
+
+// The FPU answers an invalid operation (inf - inf, 0 * inf, 0 / 0) with its negative default NaN, and
+// an Fma can lose a NaN addend behind one. NaN lanes are put back to what the scalar operators
+// return: the first NaN operand, which decoding has already quieted, otherwise the positive QuietNaN
+template<typename Lane>
+Lane FloatBatchNaN(Lane a, Lane b) {
+    if (std::isnan(a)) {
+        return a;
+    }
+    return std::isnan(b) ? b : std::numeric_limits<Lane>::quiet_NaN();
+}
+
+template<typename Lane>
+Lane FloatBatchNaN(Lane a, Lane b, Lane c) {
+    return std::isnan(a) || std::isnan(b) ? FloatBatchNaN(a, b) : FloatBatchNaN(c, c);
+}
+
+// ===== DOUBLE LANES =====
+// A format with p <= 25 significand bits and at most 10 exponent bits sits well inside double. A
+// double sum, product or quotient of two such values carries at least 2p + 2 bits, so rounding it
+// once more into the format is still correctly rounded. That holds into the subnormal range too.
+template<size_t ExpBits, size_t MantissaBits>
+inline constexpr bool FloatBatchFitsDouble = ExpBits <= 10 && MantissaBits <= 24;
+
+template<size_t ExpBits, size_t MantissaBits>
+double FloatBatchDecode(uint64_t bits) {
+    constexpr uint64_t bias = (uint64_t{1} << (ExpBits - 1)) - 1;
+    constexpr uint64_t maxExponent = (uint64_t{1} << ExpBits) - 1;
+    constexpr unsigned dropped = 52 - MantissaBits;
+    // Weight of the last mantissa bit of a subnormal, as a double
+    const double subnormalUlp = std::bit_cast<double>((1023 + 1 - bias - MantissaBits) << 52);
+
+    const uint64_t mantissa = bits & LimbMask(MantissaBits);
+    const uint64_t exponent = bits >> MantissaBits & maxExponent;
+    const uint64_t sign = (bits >> (ExpBits + MantissaBits) & 1) << 63;
+    if (exponent - 1 < maxExponent - 1) [[likely]] {
+        return std::bit_cast<double>(sign | (exponent + 1023 - bias) << 52 | mantissa << dropped);
+    }
+    if (exponent == maxExponent) {
+        // Infinity, or a NaN that comes out quiet with its payload on top
+        const uint64_t quiet = mantissa != 0 ? uint64_t{1} << 51 : 0;
+        return std::bit_cast<double>(sign | 0x7FF0000000000000 | mantissa << dropped | quiet);
+    }
+    // Zero or subnormal: an integer number of subnormal steps, which double holds exactly
+    return std::bit_cast<double>(sign | std::bit_cast<uint64_t>(static_cast<double>(mantissa) * subnormalUlp));
+}
+
+template<size_t ExpBits, size_t MantissaBits>
+uint64_t FloatBatchEncode(double value) {
+    constexpr uint64_t bias = (uint64_t{1} << (ExpBits - 1)) - 1;
+    constexpr uint64_t infinity = ((uint64_t{1} << ExpBits) - 1) << MantissaBits;
+    constexpr unsigned dropped = 52 - MantissaBits;
+    // Halfway between the largest finite value and the next power of two rounds up to infinity
+    constexpr uint64_t overflow = ((1023 + bias + 1) << 52) - (uint64_t{1} << (dropped - 1));
+    constexpr uint64_t minNormal = (1023 + 1 - bias) << 52;
+
+    const uint64_t bits = std::bit_cast<uint64_t>(value);
+    const uint64_t sign = (bits >> 63) << (ExpBits + MantissaBits);
+    uint64_t magnitude = bits & 0x7FFFFFFFFFFFFFFF;
+    if (magnitude - minNormal < overflow - minNormal) [[likely]] {
+        // Normal result: rebias, then round to nearest even on the dropped bits; a carry bumps the exponent
+        magnitude -= (1023 - bias) << 52;
+        magnitude += (uint64_t{1} << (dropped - 1)) - 1 + (magnitude >> dropped & 1);
+        return sign | magnitude >> dropped;
+    }
+    if (magnitude > 0x7FF0000000000000) {
+        return sign | infinity | (magnitude >> dropped & LimbMask(MantissaBits)) | uint64_t{1} << (MantissaBits - 1);
+    }
+    if (magnitude >= overflow) {
+        return sign | infinity;
+    }
+    // Subnormal result: round the significand onto the fixed grid of the last subnormal bit
+    const uint64_t shift = 1076 - bias - MantissaBits - (magnitude >> 52);
+    if (shift > 53) {
+        return sign;
+    }
+    const uint64_t significand = (magnitude & LimbMask(52)) | uint64_t{1} << 52;
+    const uint64_t kept = significand >> shift;
+    const uint64_t rest = significand & LimbMask(shift);
+    const uint64_t half = uint64_t{1} << (shift - 1);
+    return sign | (kept + (rest > half || (rest == half && (kept & 1) != 0)));
+}
+
+inline double FloatBatchFmaToOdd(double a, double b, double c) {
+    // a * b is exact for FloatBatchFitsDouble formats. TwoSum recovers the error of the sum, and an
+    // inexact sum is rounded to odd, which survives the second rounding as long as the format is
+    // at least two bits narrower than double
+    const double product = a * b;
+    const double sum = product + c;
+    const double productPart = sum - c;
+    const double addendPart = sum - productPart;
+    const double error = (product - productPart) + (c - addendPart);
+    uint64_t bits = std::bit_cast<uint64_t>(sum);
+    if (std::isfinite(sum) && error != 0 && (bits & 1) == 0) {
+        // Step to the odd neighbour on the side of the error
+        bits = (error > 0) == (sum > 0) ? bits + 1 : bits - 1;
+    }
+    return std::bit_cast<double>(bits);
+}
+
+template<size_t ExpBits, size_t MantissaBits>
+void FloatBatchDecodePortable(const uint64_t* bits, double* lanes, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        lanes[i] = FloatBatchDecode<ExpBits, MantissaBits>(bits[i]);
+    }
+}
+
+template<size_t ExpBits, size_t MantissaBits>
+void FloatBatchEncodePortable(const double* lanes, uint64_t* bits, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        bits[i] = FloatBatchEncode<ExpBits, MantissaBits>(lanes[i]);
+    }
+}
+
+inline void FloatBatchFmaPortable(double* out, const double* x, const double* y, const double* z, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = FloatBatchFmaToOdd(x[i], y[i], z[i]);
+    }
+}
+
+#if FLOAT_BATCH_HAS_X86_KERNELS
+// The same field arithmetic four lanes at a time: every case is computed and the right one blended in
+template<size_t ExpBits, size_t MantissaBits>
+__attribute__((target("avx2"))) void FloatBatchDecodeAvx2(const uint64_t* bits, double* lanes, size_t count) {
+    constexpr uint64_t bias = (uint64_t{1} << (ExpBits - 1)) - 1;
+    constexpr uint64_t maxExponent = (uint64_t{1} << ExpBits) - 1;
+    constexpr int dropped = 52 - MantissaBits;
+    const __m256i mantissaMask = _mm256_set1_epi64x(static_cast<int64_t>(LimbMask(MantissaBits)));
+    const __m256i exponentMask = _mm256_set1_epi64x(maxExponent);
+    const __m256i rebias = _mm256_set1_epi64x(1023 - bias);
+    const __m256i infinity = _mm256_set1_epi64x(0x7FF0000000000000);
+    const __m256i quietBit = _mm256_set1_epi64x(int64_t{1} << 51);
+    const __m256i zero = _mm256_setzero_si256();
+    // OR-ing an integer below 2^52 into the mantissa of 2^52 and subtracting 2^52 converts it exactly
+    const __m256i magic = _mm256_set1_epi64x(0x4330000000000000);
+    const __m256d magicValue = _mm256_set1_pd(0x1p52);
+    const __m256d subnormalUlp = _mm256_set1_pd(std::bit_cast<double>((1023 + 1 - bias - MantissaBits) << 52));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + i));
+        const __m256i mantissa = _mm256_and_si256(value, mantissaMask);
+        const __m256i exponent = _mm256_and_si256(_mm256_srli_epi64(value, MantissaBits), exponentMask);
+        const __m256i sign = _mm256_slli_epi64(_mm256_srli_epi64(value, ExpBits + MantissaBits), 63);
+        const __m256i shifted = _mm256_slli_epi64(mantissa, dropped);
+        const __m256i normal = _mm256_or_si256(_mm256_slli_epi64(_mm256_add_epi64(exponent, rebias), 52), shifted);
+        const __m256i quiet = _mm256_andnot_si256(_mm256_cmpeq_epi64(mantissa, zero), quietBit);
+        const __m256i special = _mm256_or_si256(_mm256_or_si256(infinity, shifted), quiet);
+        const __m256d subnormal = _mm256_mul_pd(_mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(mantissa, magic)), magicValue), subnormalUlp);
+        __m256i result = _mm256_blendv_epi8(normal, special, _mm256_cmpeq_epi64(exponent, exponentMask));
+        result = _mm256_blendv_epi8(result, _mm256_castpd_si256(subnormal), _mm256_cmpeq_epi64(exponent, zero));
+        _mm256_storeu_pd(lanes + i, _mm256_castsi256_pd(_mm256_or_si256(result, sign)));
+    }
+    FloatBatchDecodePortable<ExpBits, MantissaBits>(bits + i, lanes + i, count - i);
+}
+
+template<size_t ExpBits, size_t MantissaBits>
+__attribute__((target("avx2"))) void FloatBatchEncodeAvx2(const double* lanes, uint64_t* bits, size_t count) {
+    constexpr uint64_t bias = (uint64_t{1} << (ExpBits - 1)) - 1;
+    constexpr int dropped = 52 - MantissaBits;
+    const __m256i absMask = _mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+    const __m256i doubleInfinity = _mm256_set1_epi64x(0x7FF0000000000000);
+    const __m256i infinity = _mm256_set1_epi64x(((uint64_t{1} << ExpBits) - 1) << MantissaBits);
+    const __m256i mantissaMask = _mm256_set1_epi64x(static_cast<int64_t>(LimbMask(MantissaBits)));
+    const __m256i quietBit = _mm256_set1_epi64x(int64_t{1} << (MantissaBits - 1));
+    const __m256i rebias = _mm256_set1_epi64x((1023 - bias) << 52);
+    const __m256i roundingBias = _mm256_set1_epi64x((int64_t{1} << (dropped - 1)) - 1);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i overflowMinusOne = _mm256_set1_epi64x(((1023 + bias + 1) << 52) - (uint64_t{1} << (dropped - 1)) - 1);
+    const __m256i minNormal = _mm256_set1_epi64x((1023 + 1 - bias) << 52);
+    const __m256i significandMask = _mm256_set1_epi64x(static_cast<int64_t>(LimbMask(52)));
+    const __m256i implicitBit = _mm256_set1_epi64x(int64_t{1} << 52);
+    const __m256i shiftBase = _mm256_set1_epi64x(1076 - bias - MantissaBits);
+    const __m256i maxShift = _mm256_set1_epi64x(63);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i raw = _mm256_castpd_si256(_mm256_loadu_pd(lanes + i));
+        const __m256i sign = _mm256_slli_epi64(_mm256_srli_epi64(raw, 63), ExpBits + MantissaBits);
+        const __m256i magnitude = _mm256_and_si256(raw, absMask);
+
+        const __m256i rebased = _mm256_sub_epi64(magnitude, rebias);
+        const __m256i rounding = _mm256_add_epi64(roundingBias, _mm256_and_si256(_mm256_srli_epi64(rebased, dropped), one));
+        const __m256i normal = _mm256_srli_epi64(_mm256_add_epi64(rebased, rounding), dropped);
+
+        const __m256i nan = _mm256_or_si256(_mm256_or_si256(infinity, _mm256_and_si256(_mm256_srli_epi64(magnitude, dropped), mantissaMask)), quietBit);
+
+        // Subnormal lanes shift by 29 to 63; the shift is garbage in other lanes, which are blended away
+        __m256i shift = _mm256_sub_epi64(shiftBase, _mm256_srli_epi64(magnitude, 52));
+        shift = _mm256_blendv_epi8(shift, maxShift, _mm256_cmpgt_epi64(shift, maxShift));
+        const __m256i significand = _mm256_or_si256(_mm256_and_si256(magnitude, significandMask), implicitBit);
+        const __m256i kept = _mm256_srlv_epi64(significand, shift);
+        const __m256i rest = _mm256_and_si256(significand, _mm256_sub_epi64(_mm256_sllv_epi64(one, shift), one));
+        const __m256i half = _mm256_sllv_epi64(one, _mm256_sub_epi64(shift, one));
+        const __m256i odd = _mm256_cmpeq_epi64(_mm256_and_si256(kept, one), one);
+        const __m256i up = _mm256_or_si256(_mm256_cmpgt_epi64(rest, half), _mm256_and_si256(_mm256_cmpeq_epi64(rest, half), odd));
+        // up is all ones where the result rounds away from zero
+        const __m256i subnormal = _mm256_sub_epi64(kept, up);
+
+        __m256i result = _mm256_blendv_epi8(normal, subnormal, _mm256_cmpgt_epi64(minNormal, magnitude));
+        result = _mm256_blendv_epi8(result, infinity, _mm256_cmpgt_epi64(magnitude, overflowMinusOne));
+        result = _mm256_blendv_epi8(result, nan, _mm256_cmpgt_epi64(magnitude, doubleInfinity));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(bits + i), _mm256_or_si256(result, sign));
+    }
+    FloatBatchEncodePortable<ExpBits, MantissaBits>(lanes + i, bits + i, count - i);
+}
+
+__attribute__((target("avx2"))) inline void FloatBatchFmaAvx2(double* out, const double* x, const double* y, const double* z, size_t count) {
+    const __m256i exponentMask = _mm256_set1_epi64x(0x7FF0000000000000);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d c = _mm256_loadu_pd(z + i);
+        const __m256d product = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+        const __m256d sum = _mm256_add_pd(product, c);
+        const __m256d productPart = _mm256_sub_pd(sum, c);
+        const __m256d addendPart = _mm256_sub_pd(sum, productPart);
+        const __m256d error = _mm256_add_pd(_mm256_sub_pd(product, productPart), _mm256_sub_pd(c, addendPart));
+
+        const __m256i bits = _mm256_castpd_si256(sum);
+        const __m256i finite = _mm256_xor_si256(_mm256_cmpeq_epi64(_mm256_and_si256(bits, exponentMask), exponentMask), _mm256_set1_epi64x(-1));
+        const __m256i inexact = _mm256_castpd_si256(_mm256_cmp_pd(error, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+        const __m256i even = _mm256_cmpeq_epi64(_mm256_and_si256(bits, one), zero);
+        // +1 when the error has the sign of the sum, -1 otherwise
+        const __m256i signsDiffer = _mm256_srli_epi64(_mm256_xor_si256(_mm256_castpd_si256(error), bits), 63);
+        const __m256i step = _mm256_sub_epi64(one, _mm256_slli_epi64(signsDiffer, 1));
+        const __m256i adjust = _mm256_and_si256(_mm256_and_si256(finite, _mm256_and_si256(inexact, even)), step);
+        _mm256_storeu_pd(out + i, _mm256_castsi256_pd(_mm256_add_epi64(bits, adjust)));
+    }
+    FloatBatchFmaPortable(out + i, x + i, y + i, z + i, count - i);
+}
+#endif
+
+template<size_t ExpBits, size_t MantissaBits>
+void FloatBatchDecodeLanes(const uint64_t* bits, double* lanes, size_t count) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+    if (FloatBatchCpuHasAvx2()) {
+        FloatBatchDecodeAvx2<ExpBits, MantissaBits>(bits, lanes, count);
+        return;
+    }
+#endif
+    FloatBatchDecodePortable<ExpBits, MantissaBits>(bits, lanes, count);
+}
+
+template<size_t ExpBits, size_t MantissaBits>
+void FloatBatchEncodeLanes(const double* lanes, uint64_t* bits, size_t count) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+    if (FloatBatchCpuHasAvx2()) {
+        FloatBatchEncodeAvx2<ExpBits, MantissaBits>(lanes, bits, count);
+        return;
+    }
+#endif
+    FloatBatchEncodePortable<ExpBits, MantissaBits>(lanes, bits, count);
+}
+
+inline void FloatBatchFmaLanes(double* out, const double* x, const double* y, const double* z, size_t count) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+    if (FloatBatchCpuHasAvx2()) {
+        FloatBatchFmaAvx2(out, x, y, z, count);
+        return;
+    }
+#endif
+    FloatBatchFmaPortable(out, x, y, z, count);
+}
+
+// Elements whose bytes are exactly the little-endian encoding are read and written as raw memory
+template<typename Element>
+inline constexpr bool FloatBatchIsPacked = std::endian::native == std::endian::little && sizeof(Element) == ((Element::TotalBits() + 7) >> 3) && std::is_trivially_copyable_v<Element>;
+
+template<typename Element>
+void FloatBatchLoadBits(const Element* in, uint64_t* bits, size_t count) {
+    constexpr size_t bytes = (Element::TotalBits() + 7) >> 3;
+    if constexpr (FloatBatchIsPacked<Element>) {
+        const auto* raw = reinterpret_cast<const uint8_t*>(in);
+        for (size_t i = 0; i < count; ++i) {
+            bits[i] = 0;
+            std::memcpy(&bits[i], raw + i * bytes, bytes);
+        }
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            const auto encoding = in[i].ToLeBytes();
+            bits[i] = 0;
+            for (size_t j = 0; j < bytes; ++j) {
+                bits[i] |= static_cast<uint64_t>(encoding[j]) << (8 * j);
+            }
+        }
+    }
+}
+
+template<typename Element>
+void FloatBatchStoreBits(const uint64_t* bits, Element* out, size_t count) {
+    constexpr size_t bytes = (Element::TotalBits() + 7) >> 3;
+    if constexpr (FloatBatchIsPacked<Element>) {
+        auto* raw = reinterpret_cast<uint8_t*>(out);
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(raw + i * bytes, &bits[i], bytes);
+        }
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            std::array<uint8_t, bytes> encoding;
+            for (size_t j = 0; j < bytes; ++j) {
+                encoding[j] = static_cast<uint8_t>(bits[i] >> (8 * j));
+            }
+            out[i] = Element::FromLeBytes(encoding);
+        }
+    }
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void FloatBatchDecodeChunk(const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>* in, uint64_t* bits, double* lanes, size_t count) {
+    FloatBatchLoadBits(in, bits, count);
+    FloatBatchDecodeLanes<ExpBits, MantissaBits>(bits, lanes, count);
+}
+
+// ===== DISPATCH =====
+// float and double formats already run on the FPU, and formats of at most 8 bits on the operator
+// tables, so a plain loop over the operators is their fastest batch path
+template<size_t ExpBits, size_t MantissaBits>
+inline constexpr bool FloatBatchUsesOperators = !std::is_void_v<NativeFloatFor<ExpBits, MantissaBits>> || ExpBits + MantissaBits + 1 <= 8;
+
+// Float16 and BFloat16 are widened to float lanes by the ConvertArray kernels. float has the
+// 2p + 2 = 24 bits both formats need for + - * /
+template<size_t ExpBits, size_t MantissaBits, typename Element>
+inline constexpr bool FloatBatchUsesFloatLanes = ((ExpBits == 5 && MantissaBits == 10) || (ExpBits == 8 && MantissaBits == 7)) && FloatBatchIsPacked16<Element>;
+
+template<FloatBatchOp Op, size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void FloatBatchBinary(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    using Element = ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>;
+    if (a.size() != out.size() || b.size() != out.size()) {
+        throw std::invalid_argument("Input and output spans must have the same length");
+    }
+
+    if constexpr (FloatBatchUsesFloatLanes<ExpBits, MantissaBits, Element>) {
+        float x[FloatBatchChunk];
+        float y[FloatBatchChunk];
+        for (size_t start = 0; start < out.size(); start += FloatBatchChunk) {
+            const size_t count = std::min(FloatBatchChunk, out.size() - start);
+            ConvertArray(a.subspan(start, count), std::span<float>(x, count));
+            ConvertArray(b.subspan(start, count), std::span<float>(y, count));
+            for (size_t i = 0; i < count; ++i) {
+                const auto result = FloatBatchApply<Op>(x[i], y[i]);
+                x[i] = std::isnan(result) ? FloatBatchNaN(x[i], y[i]) : result;
+            }
+            ConvertArray(std::span<const float>(x, count), out.subspan(start, count));
+        }
+    }
+    else if constexpr (FloatBatchFitsDouble<ExpBits, MantissaBits> && !FloatBatchUsesOperators<ExpBits, MantissaBits>) {
+        uint64_t bits[FloatBatchChunk];
+        double x[FloatBatchChunk];
+        double y[FloatBatchChunk];
+        for (size_t start = 0; start < out.size(); start += FloatBatchChunk) {
+            const size_t count = std::min(FloatBatchChunk, out.size() - start);
+            FloatBatchDecodeChunk(a.data() + start, bits, x, count);
+            FloatBatchDecodeChunk(b.data() + start, bits, y, count);
+            for (size_t i = 0; i < count; ++i) {
+                const auto result = FloatBatchApply<Op>(x[i], y[i]);
+                x[i] = std::isnan(result) ? FloatBatchNaN(x[i], y[i]) : result;
+            }
+            FloatBatchEncodeLanes<ExpBits, MantissaBits>(x, bits, count);
+            FloatBatchStoreBits(bits, out.data() + start, count);
+        }
+    }
+    else {
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = FloatBatchApply<Op>(a[i], b[i]);
+        }
+    }
+}
+
+// ===== ENTRY POINTS =====
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Add(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    FloatBatchBinary<FloatBatchOp::Add>(a, b, out);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Sub(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    FloatBatchBinary<FloatBatchOp::Subtract>(a, b, out);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Mul(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    FloatBatchBinary<FloatBatchOp::Multiply>(a, b, out);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Div(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    FloatBatchBinary<FloatBatchOp::Divide>(a, b, out);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void Fma(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> a, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> b, std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> c, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    if (a.size() != out.size() || b.size() != out.size() || c.size() != out.size()) {
+        throw std::invalid_argument("Input and output spans must have the same length");
+    }
+
+    if constexpr (FloatBatchFitsDouble<ExpBits, MantissaBits> && std::is_void_v<NativeFloatFor<ExpBits, MantissaBits>>) {
+        uint64_t bits[FloatBatchChunk];
+        double x[FloatBatchChunk];
+        double y[FloatBatchChunk];
+        double z[FloatBatchChunk];
+        double fused[FloatBatchChunk];
+        for (size_t start = 0; start < out.size(); start += FloatBatchChunk) {
+            const size_t count = std::min(FloatBatchChunk, out.size() - start);
+            FloatBatchDecodeChunk(a.data() + start, bits, x, count);
+            FloatBatchDecodeChunk(b.data() + start, bits, y, count);
+            FloatBatchDecodeChunk(c.data() + start, bits, z, count);
+            FloatBatchFmaLanes(fused, x, y, z, count);
+            for (size_t i = 0; i < count; ++i) {
+                if (std::isnan(fused[i])) {
+                    fused[i] = FloatBatchNaN(x[i], y[i], z[i]);
+                }
+            }
+            FloatBatchEncodeLanes<ExpBits, MantissaBits>(fused, bits, count);
+            FloatBatchStoreBits(bits, out.data() + start, count);
+        }
+    }
+    else {
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = a[i].Fma(b[i], c[i]);
+        }
+    }
+}
+
+#endif //ARBITRARYFLOAT_BATCH_ARITHMETIC_INL
@@ -0,0 +1,239 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYFLOAT_BATCH_CONVERSION_INL
+#define ARBITRARYFLOAT_BATCH_CONVERSION_INL
+
+// Elements whose bytes are exactly the 16-bit encoding can be handed to the kernels as raw memory
+template<typename Element>
+inline constexpr bool FloatBatchIsPacked16 = sizeof(Element) == 2 && std::is_trivially_copyable_v<Element>;
+
+// ===== PORTABLE KERNELS =====
+inline float FloatBatchHalfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1F;
+    const uint32_t mantissa = half & 0x3FF;
+    if (exponent == 0x1F) {
+        // Infinity, or a NaN that comes out quiet with its payload on top
+        return std::bit_cast<float>(sign | 0x7F800000 | mantissa << 13 | (mantissa != 0 ? 0x400000 : 0));
+    }
+    if (exponent != 0) {
+        return std::bit_cast<float>(sign | (exponent + 112) << 23 | mantissa << 13);
+    }
+    if (mantissa == 0) {
+        return std::bit_cast<float>(sign);
+    }
+    // Subnormal half: every one is a normal float
+    const int shift = std::countl_zero(mantissa) - 21;
+    return std::bit_cast<float>(sign | static_cast<uint32_t>(113 - shift) << 23 | (mantissa << shift & 0x3FF) << 13);
+}
+
+inline uint16_t FloatBatchFloatToHalf(float value) {
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint16_t sign = static_cast<uint16_t>(bits >> 16 & 0x8000);
+    bits &= 0x7FFFFFFF;
+    if (bits > 0x7F800000) {
+        return sign | 0x7E00 | static_cast<uint16_t>(bits >> 13 & 0x3FF);
+    }
+    if (bits >= 0x477FF000) {
+        // 65520 and up round to infinity
+        return sign | 0x7C00;
+    }
+    if (bits < 0x38800000) {
+        // Subnormal result: shift the significand into place and round on the dropped bits
+        if (bits < 0x33000000) {
+            return sign;
+        }
+        const uint32_t exponent = bits >> 23;
+        const uint32_t significand = (bits & 0x7FFFFF) | 0x800000;
+        const uint32_t shift = 126 - exponent;
+        const uint32_t half = significand >> shift;
+        const uint32_t dropped = significand & ((uint32_t{1} << shift) - 1);
+        const uint32_t midpoint = uint32_t{1} << (shift - 1);
+        return sign | static_cast<uint16_t>(half + (dropped > midpoint || (dropped == midpoint && (half & 1) != 0)));
+    }
+    // Normal result: rebias, then round to nearest even on the 13 dropped bits; a carry bumps the exponent
+    bits += 0xC8000FFF + (bits >> 13 & 1);
+    return sign | static_cast<uint16_t>(bits >> 13);
+}
+
+inline float FloatBatchBFloat16ToFloat(uint16_t value) {
+    // bfloat16 is the top half of a float, so widening is exact (NaNs are quieted like the hardware does)
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        bits |= 0x400000;
+    }
+    return std::bit_cast<float>(bits);
+}
+
+inline uint16_t FloatBatchFloatToBFloat16(float value) {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>(bits >> 16 | 0x40);
+    }
+    // Round to nearest even on the low 16 bits; a carry rolls into the exponent, up to infinity
+    return static_cast<uint16_t>((bits + 0x7FFF + (bits >> 16 & 1)) >> 16);
+}
+
+template<float (*widen)(uint16_t)>
+void FloatBatchWidenPortable(const uint8_t* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint16_t value;
+        std::memcpy(&value, in + 2 * i, sizeof(value));
+        out[i] = widen(value);
+    }
+}
+
+template<uint16_t (*narrow)(float)>
+void FloatBatchNarrowPortable(const float* in, uint8_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint16_t value = narrow(in[i]);
+        std::memcpy(out + 2 * i, &value, sizeof(value));
+    }
+}
+
+// ===== X86 KERNELS =====
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FLOAT_BATCH_HAS_X86_KERNELS 1
+// AVX-512 BF16 (vcvtneps2bf16) flushes subnormals to zero, so it would not match the scalar
+// conversion; bfloat16 rounding runs on plain AVX2 integer ops instead.
+__attribute__((target("avx,f16c"))) inline void FloatBatchHalfToFloatF16c(const uint8_t* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i))));
+    }
+    FloatBatchWidenPortable<FloatBatchHalfToFloat>(in + 2 * i, out + i, count - i);
+}
+
+__attribute__((target("avx,f16c"))) inline void FloatBatchFloatToHalfF16c(const float* in, uint8_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), half);
+    }
+    FloatBatchNarrowPortable<FloatBatchFloatToHalf>(in + i, out + 2 * i, count - i);
+}
+
+__attribute__((target("avx2"))) inline void FloatBatchBFloat16ToFloatAvx2(const uint8_t* in, float* out, size_t count) {
+    const __m256i exponentMask = _mm256_set1_epi32(0x7F800000);
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i quietBit = _mm256_set1_epi32(0x400000);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i bits = _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i))), 16);
+        const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, absMask), exponentMask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_or_si256(bits, _mm256_and_si256(nan, quietBit)));
+    }
+    FloatBatchWidenPortable<FloatBatchBFloat16ToFloat>(in + 2 * i, out + i, count - i);
+}
+
+__attribute__((target("avx2"))) inline void FloatBatchFloatToBFloat16Avx2(const float* in, uint8_t* out, size_t count) {
+    const __m256i exponentMask = _mm256_set1_epi32(0x7F800000);
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i roundingBias = _mm256_set1_epi32(0x7FFF);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i quietBit = _mm256_set1_epi32(0x40);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i high = _mm256_srli_epi32(bits, 16);
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(roundingBias, _mm256_and_si256(high, one))), 16);
+        const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, absMask), exponentMask);
+        const __m256i result = _mm256_blendv_epi8(rounded, _mm256_or_si256(high, quietBit), nan);
+        // Pack the eight 32-bit lanes down to 16 bits; packus works per 128-bit half, so regroup the halves
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0b1000);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm256_castsi256_si128(packed));
+    }
+    FloatBatchNarrowPortable<FloatBatchFloatToBFloat16>(in + i, out + 2 * i, count - i);
+}
+
+inline bool FloatBatchCpuHasF16c() {
+#if defined(__F16C__) && defined(__AVX__)
+    return true;
+#else
+    static const bool supported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    return supported;
+#endif
+}
+
+inline bool FloatBatchCpuHasAvx2() {
+#if defined(__AVX2__)
+    return true;
+#else
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#endif
+}
+#else
+#define FLOAT_BATCH_HAS_X86_KERNELS 0
+#endif
+
+// ===== ENTRY POINTS =====
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void ConvertArray(std::span<const ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> in, std::span<float> out) {
+    using Element = ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>;
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output spans must have the same length");
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(in.data());
+
+    if constexpr (ExpBits == 5 && MantissaBits == 10 && FloatBatchIsPacked16<Element>) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+        if (FloatBatchCpuHasF16c()) {
+            FloatBatchHalfToFloatF16c(bytes, out.data(), in.size());
+            return;
+        }
+#endif
+        FloatBatchWidenPortable<FloatBatchHalfToFloat>(bytes, out.data(), in.size());
+    }
+    else if constexpr (ExpBits == 8 && MantissaBits == 7 && FloatBatchIsPacked16<Element>) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+        if (FloatBatchCpuHasAvx2()) {
+            FloatBatchBFloat16ToFloatAvx2(bytes, out.data(), in.size());
+            return;
+        }
+#endif
+        FloatBatchWidenPortable<FloatBatchBFloat16ToFloat>(bytes, out.data(), in.size());
+    }
+    else {
+        for (size_t i = 0; i < in.size(); ++i) {
+            out[i] = static_cast<float>(in[i]);
+        }
+    }
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+void ConvertArray(std::span<const float> in, std::span<ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>> out) {
+    using Element = ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>;
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output spans must have the same length");
+    }
+    auto* bytes = reinterpret_cast<uint8_t*>(out.data());
+
+    if constexpr (ExpBits == 5 && MantissaBits == 10 && FloatBatchIsPacked16<Element>) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+        if (FloatBatchCpuHasF16c()) {
+            FloatBatchFloatToHalfF16c(in.data(), bytes, in.size());
+            return;
+        }
+#endif
+        FloatBatchNarrowPortable<FloatBatchFloatToHalf>(in.data(), bytes, in.size());
+    }
+    else if constexpr (ExpBits == 8 && MantissaBits == 7 && FloatBatchIsPacked16<Element>) {
+#if FLOAT_BATCH_HAS_X86_KERNELS
+        if (FloatBatchCpuHasAvx2()) {
+            FloatBatchFloatToBFloat16Avx2(in.data(), bytes, in.size());
+            return;
+        }
+#endif
+        FloatBatchNarrowPortable<FloatBatchFloatToBFloat16>(in.data(), bytes, in.size());
+    }
+    else {
+        for (size_t i = 0; i < in.size(); ++i) {
+            out[i] = Element(in[i]);
+        }
+    }
+}
+
+#endif //ARBITRARYFLOAT_BATCH_CONVERSION_INL
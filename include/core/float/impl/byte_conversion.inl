@@ -8,21 +8,71 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ToBeBytes() const {
+    std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)> result;
+    constexpr size_t storageSize = ((ExpBits + MantissaBits + 1 + 7) >> 3);
+
+    // Copy bytes from storage and reverse for big-endian
+    for (size_t i = 0; i < storageSize; ++i) {
+        result[i] = storage_.data_[storageSize - 1 - i];
+    }
+
+    return result;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ToLeBytes() const {
+    std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)> result;
+    constexpr size_t storageSize = ((ExpBits + MantissaBits + 1 + 7) >> 3);
+
+    // Copy bytes directly for little-endian (storage is already little-endian)
+    for (size_t i = 0; i < storageSize; ++i) {
+        result[i] = storage_.data_[i];
+    }
+
+    return result;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ToNeBytes() const {
+    // Native endian - check system endianness
+    if constexpr (std::endian::native == std::endian::little) {
+        return ToLeBytes();
+    }
+    else {
+        return ToBeBytes();
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromBeBytes(const std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)>& bytes) {
+    ArbitraryFloat result;
+    constexpr size_t storageSize = ((ExpBits + MantissaBits + 1 + 7) >> 3);
+
+    // Convert from big-endian by reversing byte order
+    for (size_t i = 0; i < storageSize; ++i) {
+        result.storage_.data_[i] = bytes[storageSize - 1 - i];
+    }
+
+    return result;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromLeBytes(const std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)>& bytes) {
+    ArbitraryFloat result;
+    constexpr size_t storageSize = ((ExpBits + MantissaBits + 1 + 7) >> 3);
+
+    // Copy bytes directly for little-endian
+    for (size_t i = 0; i < storageSize; ++i) {
+        result.storage_.data_[i] = bytes[i];
+    }
+
+    return result;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromNeBytes(const std::array<uint8_t, ((ExpBits + MantissaBits + 1 + 7) >> 3)>& bytes) {
+    // Native endian - check system endianness
+    if constexpr (std::endian::native == std::endian::little) {
+        return FromLeBytes(bytes);
+    }
+    else {
+        return FromBeBytes(bytes);
+    }
 }
 
 #endif //ARBITRARYFLOAT_BYTE_CONVERSION_INL
@@ -7,51 +7,112 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator==(const ArbitraryFloat& other) const {
+    return (*this <=> other) == 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator!=(const ArbitraryFloat& other) const {
+    return !(*this == other);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<(const ArbitraryFloat& other) const {
+    return (*this <=> other) < 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<=(const ArbitraryFloat& other) const {
+    return (*this <=> other) <= 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator>(const ArbitraryFloat& other) const {
+    return (*this <=> other) > 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator>=(const ArbitraryFloat& other) const {
+    return (*this <=> other) >= 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 std::partial_ordering ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<=>(const ArbitraryFloat& other) const {
+    // IEEE 754 ordering: -0 and +0 are equal, and a NaN is unordered with everything, itself included
+    if constexpr (HasNativeType) {
+        return ToNative<NativeType>() <=> other.template ToNative<NativeType>();
+    }
+    else {
+        if (IsNaN() || other.IsNaN()) {
+            return std::partial_ordering::unordered;
+        }
+        if (IsZero() && other.IsZero()) {
+            return std::partial_ordering::equivalent;
+        }
+        const bool sign = GetSignBit();
+        if (sign != other.GetSignBit()) {
+            return sign ? std::partial_ordering::less : std::partial_ordering::greater;
+        }
+        // Below the sign bit the encoding orders magnitudes like an unsigned integer
+        constexpr size_t magnitudeBits = totalBits - 1;
+        for (size_t i = LimbCountForBits(magnitudeBits); i-- > 0;) {
+            const Limb mask = LimbMask(magnitudeBits - i * LimbBits);
+            const Limb magnitude = storage_.LoadLimb(i * LimbBits) & mask;
+            const Limb otherMagnitude = other.storage_.LoadLimb(i * LimbBits) & mask;
+            if (magnitude != otherMagnitude) {
+                return (magnitude > otherMagnitude) != sign ? std::partial_ordering::greater : std::partial_ordering::less;
+            }
+        }
+        return std::partial_ordering::equivalent;
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator==(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return (*this <=> other) == 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator!=(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return !(*this == other);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return (*this <=> other) < 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<=(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return (*this <=> other) <= 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator>(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return (*this <=> other) > 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator>=(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    return (*this <=> other) >= 0;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t OtherExpBits, size_t OtherMantBits, typename OtherStorageProvider>
 std::partial_ordering ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator<=>(const ArbitraryFloat<OtherExpBits, OtherMantBits, OtherStorageProvider>& other) const {
+    // Both formats convert exactly into one with the wider exponent and the wider mantissa
+    using Common = ArbitraryFloat<std::max(ExpBits, OtherExpBits), std::max(MantissaBits, OtherMantBits), StorageProviderType>;
+    return static_cast<Common>(*this) <=> static_cast<Common>(other);
 }
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+uint64_t ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Hash() const {
+    // Mantissa in the low MantissaBits, then the exponent, then the sign
+    constexpr size_t limbCount = LimbCountForBits(totalBits);
+    const bool exponentAllOnes = storage_.TestBitRange(MantissaBits, ExpBits, true);
+    const bool mantissaZero = storage_.TestBitRange(0, MantissaBits, false);
+    if (exponentAllOnes && !mantissaZero) {
+        // Every NaN payload and sign hashes as the same NaN
+        return LimbHashMix(LimbHashSecret[2], totalBits);
+    }
+    if (mantissaZero && storage_.TestBitRange(MantissaBits, ExpBits, false)) {
+        // -0 hashes as +0
+        return LimbHashLimbs([](size_t) { return Limb{0}; }, limbCount);
+    }
+    return LimbHashLimbs([this](size_t i) {
+        return storage_.LoadLimb(i * LimbBits) & LimbMask(totalBits - i * LimbBits);
+    }, limbCount);
+}
+
 #endif //ARBITRARYFLOAT_COMPARISON_INL
@@ -7,9 +7,11 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::GetSignBit() const {
+    return storage_.GetBit(totalBits - 1);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 void ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::SetSignBit(bool sign) {
+    storage_.SetBit(totalBits - 1, sign);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t ExpSize, size_t ExpOffset, typename ExpStorageProviderType>
@@ -29,6 +31,9 @@ ArbitraryUnsignedInt<MantSize, MantOffset, MantStorageProviderType> ArbitraryFlo
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromComponents(bool sign, uint64_t exponent, uint64_t mantissa) {
+    std::array<Limb, LimbCountForBits(MantissaBits)> mantissaLimbs{};
+    mantissaLimbs[0] = mantissa;
+    return Pack(sign, exponent, mantissaLimbs.data());
 }
 
 #endif //ARBITRARYFLOAT_COMPONENT_ACCESS_INL
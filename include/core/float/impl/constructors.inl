@@ -6,15 +6,15 @@
 #define ARBITRARYFLOAT_CONSTRUTORS_INL
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ArbitraryFloat(float value) {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::ArbitraryFloat(float value)
-    throw std::runtime_error("ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::ArbitraryFloat(float value) not implemented.");
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ArbitraryFloat(float value)
+    : ArbitraryFloat(static_cast<ArbitraryFloat>(ArbitraryFloat<8, 23, StorageProviderType>::FromNative(value))) {
+    static_assert(NativeFloatMatches<float, 8, 23>, "float must be IEEE 754 binary32.");
 }
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ArbitraryFloat(double value) {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::ArbitraryFloat(double value)
-    throw std::runtime_error("ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::ArbitraryFloat(double value) not implemented.");
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ArbitraryFloat(double value)
+    : ArbitraryFloat(static_cast<ArbitraryFloat>(ArbitraryFloat<11, 52, StorageProviderType>::FromNative(value))) {
+    static_assert(NativeFloatMatches<double, 11, 52>, "double must be IEEE 754 binary64.");
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ArbitraryFloat(long double value) {
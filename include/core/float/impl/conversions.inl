@@ -7,12 +7,24 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator float() const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator float() const
-    throw std::runtime_error("ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator float() not implemented.");
+    static_assert(NativeFloatMatches<float, 8, 23>, "float must be IEEE 754 binary32.");
+    if constexpr (HasDecodeTable) {
+        // The decoded double is exact, so narrowing it rounds only once
+        return static_cast<float>(DecodeTable()[GetEncoding()]);
+    }
+    else {
+        return static_cast<ArbitraryFloat<8, 23, StorageProviderType>>(*this).template ToNative<float>();
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator double() const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProvider>::operator double() not implemented.");
+    static_assert(NativeFloatMatches<double, 11, 52>, "double must be IEEE 754 binary64.");
+    if constexpr (HasDecodeTable) {
+        return DecodeTable()[GetEncoding()];
+    }
+    else {
+        return static_cast<ArbitraryFloat<11, 52, StorageProviderType>>(*this).template ToNative<double>();
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator long double() const {
@@ -57,7 +69,35 @@ ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator bool() cons
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t NewExp, size_t NewMant, typename NewStorageProviderType> requires StorageProvider<NewStorageProviderType, ((NewExp + NewMant + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator ArbitraryFloat<NewExp, NewMant, NewStorageProviderType>() const {
-    // TODO: Implement ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator ArbitraryFloat<NewExp, NewMant, NewStorageProviderType>() not implemented.");
+    using Target = ArbitraryFloat<NewExp, NewMant, NewStorageProviderType>;
+    if constexpr (NewExp == ExpBits && NewMant == MantissaBits) {
+        return Target::FromLeBytes(ToLeBytes());
+    }
+    else {
+        Unpacked x = Unpack();
+        switch (x.category) {
+            case Category::Zero:
+                return x.sign ? Target::NegativeZero() : Target::Zero();
+            case Category::Infinite:
+                return x.sign ? Target::NegativeInfinity() : Target::Infinity();
+            case Category::NaN: {
+                // Keep the top of the payload and quiet it, as hardware conversions do
+                constexpr size_t payloadLimbs = std::max(LimbCountForBits(MantissaBits), LimbCountForBits(NewMant)) + 1;
+                std::array<Limb, payloadLimbs> payload{};
+                std::copy_n(x.significand.begin(), LimbCountForBits(MantissaBits), payload.begin());
+                if constexpr (NewMant > MantissaBits) {
+                    LimbShiftLeftBits(payload.data(), payloadLimbs, payload.data(), LimbCountForBits(MantissaBits), NewMant - MantissaBits);
+                }
+                else if constexpr (NewMant < MantissaBits) {
+                    LimbShiftRightBits(payload.data(), payloadLimbs, MantissaBits - NewMant);
+                }
+                payload[(NewMant - 1) / LimbBits] |= Limb{1} << ((NewMant - 1) % LimbBits);
+                return Target::Pack(x.sign, Target::MaxExponent(), payload.data());
+            }
+            default:
+                return Target::RoundAndPack(x.sign, x.exponent - static_cast<int64_t>(MantissaBits), x.significand.data(), SignificandLimbs, false);
+        }
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 template<size_t BitSize, size_t BitOffset, typename IntStorageProviderType> requires StorageProvider<IntStorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -7,33 +7,46 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsFinite() const {
+    return !IsSpecialValue();
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsInf() const {
+    return IsSpecialValue() && storage_.TestBitRange(0, MantissaBits, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsNaN() const {
+    return IsSpecialValue() && !storage_.TestBitRange(0, MantissaBits, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsNormal() const {
+    return !IsSpecialValue() && !storage_.TestBitRange(MantissaBits, ExpBits, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsSubnormal() const {
+    return storage_.TestBitRange(MantissaBits, ExpBits, false) && !storage_.TestBitRange(0, MantissaBits, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsZero() const {
+    return storage_.TestBitRange(0, MantissaBits + ExpBits, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::SignBit() const {
+    return GetSignBit();
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsPositive() const {
+    return !GetSignBit() && !IsZero() && !IsNaN();
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsNegative() const {
+    return GetSignBit() && !IsZero() && !IsNaN();
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 int ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Sign() const {
+    if (IsZero() || IsNaN()) {
+        return 0;
+    }
+    return GetSignBit() ? -1 : 1;
 }
 
 #endif //ARBITRARYFLOAT_IEEE754_QUERIES_INL
@@ -0,0 +1,82 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYFLOAT_LOOKUP_TABLES_INL
+#define ARBITRARYFLOAT_LOOKUP_TABLES_INL
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+typename ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Encoding ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::GetEncoding() const {
+    static_assert(totalBits <= 16, "Only tiny formats are addressed by their encoding.");
+    // Byte access rather than LoadLimb: the limb window on a one- or two-byte storage goes through the stack
+    const auto bytes = ToLeBytes();
+    uint16_t encoding = bytes[0];
+    if constexpr (storageBytes > 1) {
+        encoding |= static_cast<uint16_t>(bytes[1] << 8);
+    }
+    return static_cast<Encoding>(encoding & LimbMask(totalBits));
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromEncoding(Encoding encoding) {
+    static_assert(totalBits <= 16, "Only tiny formats are addressed by their encoding.");
+    std::array<uint8_t, storageBytes> bytes;
+    bytes[0] = static_cast<uint8_t>(encoding);
+    if constexpr (storageBytes > 1) {
+        bytes[1] = static_cast<uint8_t>(encoding >> 8);
+    }
+    return FromLeBytes(bytes);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+const std::array<double, ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::DecodeTableSize>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::DecodeTable() requires HasDecodeTable {
+    // Every format of at most 12 bits is exact in a double, NaN payloads included
+    static const std::array<double, DecodeTableSize> table = [] {
+        std::array<double, DecodeTableSize> values;
+        for (size_t i = 0; i < DecodeTableSize; ++i) {
+            values[i] = static_cast<ArbitraryFloat<11, 52, StorageProviderType>>(FromEncoding(static_cast<Encoding>(i))).template ToNative<double>();
+        }
+        return values;
+    }();
+    return table;
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+template<typename ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::TableOp Op>
+const std::array<typename ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Encoding, ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::BinaryTableSize>& ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::BinaryTable() requires HasBinaryTables {
+    // Indexed by (a << totalBits) | b; each operator's table is built the first time it is used
+    static const std::array<Encoding, BinaryTableSize> table = [] {
+        std::array<Encoding, BinaryTableSize> results;
+        constexpr size_t count = size_t{1} << totalBits;
+        for (size_t i = 0; i < count; ++i) {
+            const ArbitraryFloat a = FromEncoding(static_cast<Encoding>(i));
+            for (size_t j = 0; j < count; ++j) {
+                const ArbitraryFloat b = FromEncoding(static_cast<Encoding>(j));
+                ArbitraryFloat result;
+                if constexpr (Op == TableOp::Add) {
+                    result = AddOrSubtract(a, b, false);
+                }
+                else if constexpr (Op == TableOp::Subtract) {
+                    result = AddOrSubtract(a, b, true);
+                }
+                else if constexpr (Op == TableOp::Multiply) {
+                    result = Multiply(a, b);
+                }
+                else {
+                    result = Divide(a, b);
+                }
+                results[i << totalBits | j] = result.GetEncoding();
+            }
+        }
+        return results;
+    }();
+    return table;
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+template<typename ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::TableOp Op>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromBinaryTable(const ArbitraryFloat& a, const ArbitraryFloat& b) requires HasBinaryTables {
+    return FromEncoding(BinaryTable<Op>()[static_cast<size_t>(a.GetEncoding()) << totalBits | b.GetEncoding()]);
+}
+
+#endif //ARBITRARYFLOAT_LOOKUP_TABLES_INL
@@ -0,0 +1,393 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYFLOAT_SOFT_FLOAT_INL
+#define ARBITRARYFLOAT_SOFT_FLOAT_INL
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+template<typename Native>
+Native ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::ToNative() const {
+    return std::bit_cast<Native>(ToLeBytes());
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+template<typename Native>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FromNative(Native value) {
+    return FromLeBytes(std::bit_cast<std::array<uint8_t, sizeof(Native)>>(value));
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+typename ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Unpacked ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Unpack() const {
+    static_assert(ExpBits <= 60, "Soft-float exponents are tracked in 64-bit integers.");
+    constexpr int64_t bias = static_cast<int64_t>(ExponentBias());
+    constexpr size_t mantissaLimbs = LimbCountForBits(MantissaBits);
+
+    // Read the whole encoding once: mantissa in the low MantissaBits, then the exponent, then the sign
+    constexpr size_t imageLimbs = LimbCountForBits(totalBits);
+    std::array<Limb, imageLimbs + 1> image{};
+    for (size_t i = 0; i < imageLimbs; ++i) {
+        image[i] = storage_.LoadLimb(i * LimbBits);
+    }
+    image[imageLimbs - 1] &= LimbMask(totalBits - (imageLimbs - 1) * LimbBits);
+
+    constexpr unsigned fieldShift = MantissaBits % LimbBits;
+    Limb field = image[MantissaBits / LimbBits] >> fieldShift;
+    if (fieldShift != 0) {
+        field |= image[MantissaBits / LimbBits + 1] << (LimbBits - fieldShift);
+    }
+    const uint64_t biased = field & LimbMask(ExpBits);
+
+    Unpacked result{Category::Finite, (field >> ExpBits & 1) != 0, 0, {}};
+    std::copy_n(image.begin(), mantissaLimbs, result.significand.begin());
+    result.significand[mantissaLimbs - 1] &= LimbMask(MantissaBits - (mantissaLimbs - 1) * LimbBits);
+    const bool mantissaZero = LimbCountLeadingZeros(result.significand.data(), mantissaLimbs) == mantissaLimbs * LimbBits;
+
+    if (biased == MaxExponent()) {
+        result.category = mantissaZero ? Category::Infinite : Category::NaN;
+        return result;
+    }
+    if (biased != 0) {
+        result.significand[MantissaBits / LimbBits] |= Limb{1} << (MantissaBits % LimbBits);
+        result.exponent = static_cast<int64_t>(biased) - bias;
+        return result;
+    }
+    if (mantissaZero) {
+        result.category = Category::Zero;
+        return result;
+    }
+
+    // Subnormal: bring the leading bit up to the implicit position
+    const size_t top = SignificandLimbs * LimbBits - 1 - LimbCountLeadingZeros(result.significand.data(), SignificandLimbs);
+    const size_t shift = MantissaBits - top;
+    LimbShiftLeftBits(result.significand.data(), SignificandLimbs, result.significand.data(), LimbCountForBits(top + 1), shift);
+    result.exponent = 1 - bias - static_cast<int64_t>(shift);
+    return result;
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Quieted() const {
+    // NaN operands propagate with the quiet bit (top mantissa bit) set, as the hardware does
+    ArbitraryFloat result = *this;
+    result.storage_.SetBit(MantissaBits - 1, true);
+    return result;
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Pack(bool sign, uint64_t biasedExponent, const Limb* mantissa) {
+    // Assemble the whole encoding in limbs, then store it a limb at a time
+    constexpr size_t mantissaLimbs = LimbCountForBits(MantissaBits);
+    constexpr size_t imageLimbs = LimbCountForBits(totalBits);
+    std::array<Limb, imageLimbs + 1> image{};
+    std::copy_n(mantissa, mantissaLimbs, image.begin());
+    image[mantissaLimbs - 1] &= LimbMask(MantissaBits - (mantissaLimbs - 1) * LimbBits);
+
+    const Limb field = biasedExponent | Limb{sign} << ExpBits;
+    constexpr unsigned fieldShift = MantissaBits % LimbBits;
+    image[MantissaBits / LimbBits] |= field << fieldShift;
+    if (fieldShift != 0) {
+        image[MantissaBits / LimbBits + 1] |= field >> (LimbBits - fieldShift);
+    }
+
+    ArbitraryFloat result;
+    for (size_t i = 0; i < imageLimbs; ++i) {
+        result.storage_.StoreLimb(i * LimbBits, image[i], std::min(LimbBits, totalBits - i * LimbBits));
+    }
+    return result;
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::RoundAndPack(bool sign, int64_t exponent, Limb* significand, size_t n, bool sticky) {
+    // Rounds (significand + sticky) * 2^exponent to nearest even, where sticky stands for
+    // non-zero bits below the significand. The significand is clobbered.
+    constexpr int64_t bias = static_cast<int64_t>(ExponentBias());
+    constexpr int64_t mantissaBits = static_cast<int64_t>(MantissaBits);
+    // Weight of the last mantissa bit of a subnormal: nothing finer survives
+    constexpr int64_t subnormalUlp = 1 - bias - mantissaBits;
+
+    const size_t leadingZeros = LimbCountLeadingZeros(significand, n);
+    if (leadingZeros == n * LimbBits) {
+        return sign ? NegativeZero() : Zero();
+    }
+    const int64_t top = static_cast<int64_t>(n * LimbBits - 1 - leadingZeros);
+
+    // Keep MantissaBits + 1 bits below the leading one, or fewer once the result is subnormal
+    const int64_t shift = std::max(top - mantissaBits, subnormalUlp - exponent);
+    Significand kept{};
+    if (shift > 0) {
+        // Guard is the first dropped bit; everything below it folds into sticky
+        const size_t guardIndex = static_cast<size_t>(shift - 1);
+        const bool guard = guardIndex < n * LimbBits && (significand[guardIndex / LimbBits] >> (guardIndex % LimbBits) & 1) != 0;
+        sticky = sticky || LimbTestLowBits(significand, n, guardIndex);
+        LimbShiftRightBits(significand, n, static_cast<size_t>(shift));
+        std::copy_n(significand, std::min(n, SignificandLimbs), kept.begin());
+        if (guard && (sticky || (kept[0] & 1) != 0)) {
+            LimbAdd1(kept.data(), kept.data(), SignificandLimbs, 1);
+        }
+    }
+    else {
+        // top - shift <= MantissaBits, so the source always fits; the clamp makes that bound visible to the compiler
+        const size_t leftShift = static_cast<size_t>(-shift);
+        const size_t sourceLimbs = std::min(LimbCountForBits(static_cast<size_t>(top) + 1), SignificandLimbs - leftShift / LimbBits);
+        LimbShiftLeftBits(kept.data(), SignificandLimbs, significand, sourceLimbs, leftShift);
+    }
+    int64_t ulpExponent = exponent + shift;
+
+    // Rounding up may carry into a new leading bit
+    constexpr size_t carryBit = MantissaBits + 1;
+    if ((kept[carryBit / LimbBits] >> (carryBit % LimbBits) & 1) != 0) {
+        LimbShiftRightBits(kept.data(), SignificandLimbs, 1);
+        ++ulpExponent;
+    }
+
+    // A leading one at the implicit position makes the result normal; otherwise it is subnormal
+    const bool normal = (kept[MantissaBits / LimbBits] >> (MantissaBits % LimbBits) & 1) != 0;
+    const int64_t biased = normal ? ulpExponent + mantissaBits + bias : 0;
+    if (biased >= static_cast<int64_t>(MaxExponent())) {
+        return sign ? NegativeInfinity() : Infinity();
+    }
+    return Pack(sign, static_cast<uint64_t>(biased), kept.data());
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::AddOrSubtract(const ArbitraryFloat& a, const ArbitraryFloat& b, bool negateB) {
+    // Guard, round and sticky bits below the aligned significands
+    constexpr size_t guardBits = 3;
+    // The aligned sum needs the significand, the guard bits and a carry
+    constexpr size_t sumLimbs = LimbCountForBits(MantissaBits + 1 + guardBits + 1);
+
+    Unpacked x = a.Unpack();
+    Unpacked y = b.Unpack();
+    y.sign = y.sign != negateB;
+    if (x.category == Category::NaN) {
+        return a.Quieted();
+    }
+    if (y.category == Category::NaN) {
+        return b.Quieted();
+    }
+    if (x.category == Category::Infinite) {
+        // inf - inf is invalid
+        return y.category == Category::Infinite && x.sign != y.sign ? QuietNaN() : a;
+    }
+    if (y.category == Category::Infinite) {
+        return y.sign ? NegativeInfinity() : Infinity();
+    }
+    if (y.category == Category::Zero) {
+        // -0 + -0 is -0, any other pair of zeros is +0
+        return x.category == Category::Zero && x.sign != y.sign ? Zero() : a;
+    }
+    if (x.category == Category::Zero) {
+        ArbitraryFloat result = b;
+        result.SetSignBit(y.sign);
+        return result;
+    }
+
+    if (x.exponent < y.exponent || (x.exponent == y.exponent && LimbCompare(x.significand.data(), y.significand.data(), SignificandLimbs) < 0)) {
+        std::swap(x, y);
+    }
+
+    std::array<Limb, sumLimbs> sum;
+    std::array<Limb, sumLimbs> addend;
+    LimbShiftLeftBits(sum.data(), sumLimbs, x.significand.data(), SignificandLimbs, guardBits);
+    LimbShiftLeftBits(addend.data(), sumLimbs, y.significand.data(), SignificandLimbs, guardBits);
+
+    // Align the smaller operand; bits shifted past the guard bits collapse into the sticky bit
+    const uint64_t distance = static_cast<uint64_t>(x.exponent - y.exponent);
+    if (distance > MantissaBits + guardBits) {
+        addend.fill(0);
+        addend[0] = 1;
+    }
+    else if (distance > 0) {
+        const bool sticky = LimbTestLowBits(addend.data(), sumLimbs, distance);
+        LimbShiftRightBits(addend.data(), sumLimbs, distance);
+        addend[0] |= sticky;
+    }
+
+    if (x.sign == y.sign) {
+        LimbAddN(sum.data(), sum.data(), addend.data(), sumLimbs);
+    }
+    else {
+        LimbSubN(sum.data(), sum.data(), addend.data(), sumLimbs);
+        // Exact cancellation rounds to +0
+        if (LimbCountLeadingZeros(sum.data(), sumLimbs) == sumLimbs * LimbBits) {
+            return Zero();
+        }
+    }
+    return RoundAndPack(x.sign, x.exponent - static_cast<int64_t>(MantissaBits + guardBits), sum.data(), sumLimbs, false);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Multiply(const ArbitraryFloat& a, const ArbitraryFloat& b) {
+    const Unpacked x = a.Unpack();
+    const Unpacked y = b.Unpack();
+    const bool sign = x.sign != y.sign;
+    if (x.category == Category::NaN) {
+        return a.Quieted();
+    }
+    if (y.category == Category::NaN) {
+        return b.Quieted();
+    }
+    if (x.category == Category::Infinite || y.category == Category::Infinite) {
+        // inf * 0 is invalid
+        if (x.category == Category::Zero || y.category == Category::Zero) {
+            return QuietNaN();
+        }
+        return sign ? NegativeInfinity() : Infinity();
+    }
+    if (x.category == Category::Zero || y.category == Category::Zero) {
+        return sign ? NegativeZero() : Zero();
+    }
+
+    // The full 2(MantissaBits + 1)-bit product is exact; RoundAndPack takes it down to size
+    std::array<Limb, 2 * SignificandLimbs> product;
+    LimbMulFixed<SignificandLimbs>(product.data(), x.significand.data(), y.significand.data());
+    const int64_t exponent = x.exponent + y.exponent - 2 * static_cast<int64_t>(MantissaBits);
+    return RoundAndPack(sign, exponent, product.data(), product.size(), false);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Divide(const ArbitraryFloat& a, const ArbitraryFloat& b) {
+    // Quotient bits kept below the last mantissa bit; the remainder supplies the sticky bit
+    constexpr size_t extraBits = 3;
+
+    const Unpacked x = a.Unpack();
+    const Unpacked y = b.Unpack();
+    const bool sign = x.sign != y.sign;
+    if (x.category == Category::NaN) {
+        return a.Quieted();
+    }
+    if (y.category == Category::NaN) {
+        return b.Quieted();
+    }
+    if (x.category == Category::Infinite) {
+        // inf / inf is invalid
+        if (y.category == Category::Infinite) {
+            return QuietNaN();
+        }
+        return sign ? NegativeInfinity() : Infinity();
+    }
+    if (y.category == Category::Infinite) {
+        return sign ? NegativeZero() : Zero();
+    }
+    if (y.category == Category::Zero) {
+        // 0 / 0 is invalid, anything else divides to a signed infinity
+        if (x.category == Category::Zero) {
+            return QuietNaN();
+        }
+        return sign ? NegativeInfinity() : Infinity();
+    }
+    if (x.category == Category::Zero) {
+        return sign ? NegativeZero() : Zero();
+    }
+
+    // (x << (MantissaBits + extraBits)) / y leaves at least MantissaBits + extraBits quotient bits;
+    // a non-zero remainder is the sticky bit
+    constexpr size_t dividendLimbs = 2 * SignificandLimbs;
+    std::array<Limb, dividendLimbs> dividend;
+    LimbShiftLeftBits(dividend.data(), dividendLimbs, x.significand.data(), SignificandLimbs, MantissaBits + extraBits);
+    std::array<Limb, dividendLimbs> quotient;
+    Significand remainder;
+    if constexpr (SignificandLimbs == 1) {
+        // One-limb divisors skip the Knuth path entirely
+        remainder[0] = LimbDivRem1(quotient.data(), dividend.data(), dividendLimbs, y.significand[0]);
+    }
+    else {
+        std::array<Limb, LimbDivRemScratchSize(dividendLimbs, SignificandLimbs)> scratch;
+        LimbDivRem(quotient.data(), remainder.data(), dividend.data(), dividendLimbs, y.significand.data(), SignificandLimbs, scratch.data());
+    }
+
+    const bool sticky = LimbCountLeadingZeros(remainder.data(), SignificandLimbs) != SignificandLimbs * LimbBits;
+    const int64_t exponent = x.exponent - y.exponent - static_cast<int64_t>(MantissaBits + extraBits);
+    return RoundAndPack(sign, exponent, quotient.data(), dividendLimbs, sticky);
+}
+
+template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::FusedMultiplyAdd(const ArbitraryFloat& a, const ArbitraryFloat& b, const ArbitraryFloat& c) {
+    constexpr size_t guardBits = 3;
+    // Both terms are widened to the 2(MantissaBits + 1) bits of the exact product before the add
+    constexpr size_t wideBits = 2 * (MantissaBits + 1);
+    constexpr size_t productLimbs = 2 * SignificandLimbs;
+    constexpr size_t sumLimbs = LimbCountForBits(wideBits + guardBits + 1);
+
+    const Unpacked x = a.Unpack();
+    const Unpacked y = b.Unpack();
+    const Unpacked z = c.Unpack();
+    if (x.category == Category::NaN) {
+        return a.Quieted();
+    }
+    if (y.category == Category::NaN) {
+        return b.Quieted();
+    }
+    if (z.category == Category::NaN) {
+        return c.Quieted();
+    }
+    const bool productSign = x.sign != y.sign;
+    if (x.category == Category::Infinite || y.category == Category::Infinite) {
+        // inf * 0 and inf - inf are invalid
+        if (x.category == Category::Zero || y.category == Category::Zero || (z.category == Category::Infinite && z.sign != productSign)) {
+            return QuietNaN();
+        }
+        return productSign ? NegativeInfinity() : Infinity();
+    }
+    if (z.category == Category::Infinite) {
+        return c;
+    }
+    if (x.category == Category::Zero || y.category == Category::Zero) {
+        // An exact zero product adds like a signed zero
+        if (z.category == Category::Zero) {
+            return productSign && z.sign ? NegativeZero() : Zero();
+        }
+        return c;
+    }
+
+    std::array<Limb, productLimbs> product;
+    LimbMulFixed<SignificandLimbs>(product.data(), x.significand.data(), y.significand.data());
+    const int64_t productExponent = x.exponent + y.exponent - 2 * static_cast<int64_t>(MantissaBits);
+    if (z.category == Category::Zero) {
+        return RoundAndPack(productSign, productExponent, product.data(), productLimbs, false);
+    }
+
+    // Line both terms up with their leading one at bit wideBits - 1 + guardBits; exponents are the weight of bit 0
+    struct Term {
+        bool sign;
+        int64_t exponent;
+        std::array<Limb, sumLimbs> bits;
+    };
+    const size_t productTop = productLimbs * LimbBits - 1 - LimbCountLeadingZeros(product.data(), productLimbs);
+    const size_t productShift = wideBits - 1 - productTop + guardBits;
+    Term large{productSign, productExponent - static_cast<int64_t>(productShift), {}};
+    LimbShiftLeftBits(large.bits.data(), sumLimbs, product.data(), LimbCountForBits(productTop + 1), productShift);
+    constexpr size_t addendShift = wideBits - 1 - MantissaBits + guardBits;
+    Term small{z.sign, z.exponent - static_cast<int64_t>(MantissaBits + addendShift), {}};
+    LimbShiftLeftBits(small.bits.data(), sumLimbs, z.significand.data(), LimbCountForBits(MantissaBits + 1), addendShift);
+
+    if (large.exponent < small.exponent || (large.exponent == small.exponent && LimbCompare(large.bits.data(), small.bits.data(), sumLimbs) < 0)) {
+        std::swap(large, small);
+    }
+
+    // Align the smaller term; bits shifted past the guard bits collapse into the sticky bit
+    const uint64_t distance = static_cast<uint64_t>(large.exponent - small.exponent);
+    if (distance > wideBits - 1 + guardBits) {
+        small.bits.fill(0);
+        small.bits[0] = 1;
+    }
+    else if (distance > 0) {
+        const bool sticky = LimbTestLowBits(small.bits.data(), sumLimbs, distance);
+        LimbShiftRightBits(small.bits.data(), sumLimbs, distance);
+        small.bits[0] |= sticky;
+    }
+
+    if (large.sign == small.sign) {
+        LimbAddN(large.bits.data(), large.bits.data(), small.bits.data(), sumLimbs);
+    }
+    else {
+        LimbSubN(large.bits.data(), large.bits.data(), small.bits.data(), sumLimbs);
+        // Exact cancellation rounds to +0
+        if (LimbCountLeadingZeros(large.bits.data(), sumLimbs) == sumLimbs * LimbBits) {
+            return Zero();
+        }
+    }
+    return RoundAndPack(large.sign, large.exponent, large.bits.data(), sumLimbs, false);
+}
+
+#endif //ARBITRARYFLOAT_SOFT_FLOAT_INL
@@ -7,39 +7,69 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Infinity() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(false, MaxExponent(), zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::NegativeInfinity() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(true, MaxExponent(), zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::NaN() {
+    return QuietNaN();
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::QuietNaN() {
+    // Quiet NaNs have the top mantissa bit set
+    std::array<Limb, LimbCountForBits(MantissaBits)> mantissa{};
+    mantissa[(MantissaBits - 1) / LimbBits] = Limb{1} << ((MantissaBits - 1) % LimbBits);
+    return Pack(false, MaxExponent(), mantissa.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::SignalingNaN() {
+    // Top mantissa bit clear, and some other bit set so the value is not an infinity
+    std::array<Limb, LimbCountForBits(MantissaBits)> mantissa{};
+    mantissa[0] = 1;
+    return Pack(false, MaxExponent(), mantissa.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Zero() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(false, 0, zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::NegativeZero() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(true, 0, zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::One() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(false, ExponentBias(), zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::MinValue() {
+    constexpr std::array<Limb, LimbCountForBits(MantissaBits)> zero{};
+    return Pack(false, 1, zero.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::MaxValue() {
+    std::array<Limb, LimbCountForBits(MantissaBits)> mantissa;
+    mantissa.fill(~Limb{0});
+    return Pack(false, MaxExponent() - 1, mantissa.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Epsilon() {
+    // 2^-MantissaBits, which is subnormal or even zero in formats with a tiny exponent range
+    Limb one = 1;
+    return RoundAndPack(false, -static_cast<int64_t>(MantissaBits), &one, 1, false);
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::MinSubnormal() {
+    std::array<Limb, LimbCountForBits(MantissaBits)> mantissa{};
+    mantissa[0] = 1;
+    return Pack(false, 0, mantissa.data());
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Pi() {
@@ -6,12 +6,14 @@
 #define ARBITRARYFLOAT_UNARY_OPS_INL
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator+() const {
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator+() const {
     return *this;
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
-ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator-() const {
-    return this->SetSignBit(!this->GetSignBit());
+ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::operator-() const {
+    ArbitraryFloat result = *this;
+    result.SetSignBit(!GetSignBit());
+    return result;
 }
 
 #endif //ARBITRARYFLOAT_UNARY_OPS_INL
@@ -10,6 +10,8 @@ void ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Normalize() {
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 bool ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::IsSpecialValue() const {
+    // Infinities and NaNs have an all-ones exponent
+    return storage_.TestBitRange(MantissaBits, ExpBits, true);
 }
 
 #endif //ARBITRARYFLOAT_UTILITY_INL
@@ -7,9 +7,17 @@
 
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Fma(const ArbitraryFloat& y, const ArbitraryFloat& z) const {
+    // *this * y + z with a single rounding
+    if constexpr (HasNativeType) {
+        return FromNative(std::fma(ToNative<NativeType>(), y.ToNative<NativeType>(), z.ToNative<NativeType>()));
+    }
+    else {
+        return FusedMultiplyAdd(*this, y, z);
+    }
 }
 template<size_t ExpBits, size_t MantissaBits, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((ExpBits + MantissaBits + 1 + 7) >> 3)>
 ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType> ArbitraryFloat<ExpBits, MantissaBits, StorageProviderType>::Fms(const ArbitraryFloat& y, const ArbitraryFloat& z) const {
+    return Fma(y, -z);
 }
 
 #endif //ARBITRARYFLOAT_FUSED_OPS_INL
@@ -0,0 +1,491 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMBENGINE_H
+#define LIMBENGINE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Word-level building blocks shared by the storages and the number types.
+ *
+ * A multi-limb value is a little-endian sequence of 64-bit limbs: limb 0 holds
+ * bits 0..63, limb 1 holds bits 64..127 and so on. Kernels take caller-provided scratch
+ * and do not allocate, with these exceptions in the radix conversions, whose buffers are
+ * sized from the input:
+ * - LimbMulUnbalanced, above the Karatsuba threshold
+ * - LimbRadixPowers (construction)
+ * - LimbToDigitsRecursive and LimbFromDigitsRecursive, at every level
+ * - LimbToDigitsPow2, which formats base 16 through a temporary buffer
+ * - LimbToString and LimbFromString, which build on the above
+ */
+using Limb = uint64_t;
+inline constexpr size_t LimbBits = 64;
+inline constexpr size_t LimbBytes = sizeof(Limb);
+
+/**
+ * @brief Number of limbs needed to hold bitCount bits.
+ */
+constexpr size_t LimbCountForBits(size_t bitCount) {
+    return (bitCount + LimbBits - 1) / LimbBits;
+}
+
+/**
+ * @brief Mask with the low bitCount bits set. bitCount may be anywhere in [0, 64].
+ */
+constexpr Limb LimbMask(size_t bitCount) {
+    return bitCount >= LimbBits ? ~Limb{0} : ((Limb{1} << bitCount) - 1);
+}
+
+// ===== SINGLE LIMB PRIMITIVES =====
+/**
+ * @brief a + b + carry. carry is updated with the carry out of bit 63.
+ */
+inline Limb LimbAddCarry(Limb a, Limb b, bool& carry);
+
+/**
+ * @brief a - b - borrow. borrow is updated with the borrow out of bit 63.
+ */
+inline Limb LimbSubBorrow(Limb a, Limb b, bool& borrow);
+
+/**
+ * @brief Loads a limb from 8 little-endian bytes. The pointer need not be aligned.
+ */
+inline Limb LimbLoad(const uint8_t* bytes);
+
+/**
+ * @brief Stores a limb as 8 little-endian bytes. The pointer need not be aligned.
+ */
+inline void LimbStore(uint8_t* bytes, Limb value);
+
+/**
+ * @brief Full 64x64 -> 128-bit product. Returns the low limb and writes the high limb to high.
+ */
+inline Limb LimbMulWide(Limb a, Limb b, Limb& high);
+
+// ===== MULTI-LIMB ADDITION / SUBTRACTION =====
+// Unless stated otherwise the destination may alias any of the sources.
+
+/**
+ * @brief r = a + b + carry over n limbs. Returns the carry out.
+ */
+inline bool LimbAddN(Limb* r, const Limb* a, const Limb* b, size_t n, bool carry = false);
+
+/**
+ * @brief r = a - b - borrow over n limbs. Returns the borrow out.
+ */
+inline bool LimbSubN(Limb* r, const Limb* a, const Limb* b, size_t n, bool borrow = false);
+
+/**
+ * @brief r = a + b where b is a single limb. Returns the carry out.
+ */
+inline bool LimbAdd1(Limb* r, const Limb* a, size_t n, Limb b);
+
+/**
+ * @brief r = a - b where b is a single limb. Returns the borrow out.
+ */
+inline bool LimbSub1(Limb* r, const Limb* a, size_t n, Limb b);
+
+/**
+ * @brief r = -a (two's complement) over n limbs.
+ */
+inline void LimbNeg(Limb* r, const Limb* a, size_t n);
+
+/**
+ * @brief Compares two n-limb values. Returns -1, 0 or 1.
+ */
+inline int LimbCompare(const Limb* a, const Limb* b, size_t n);
+
+/**
+ * @brief r = |x - y| where x has nx limbs, y has ny >= nx limbs and r has ny limbs.
+ * Returns true when x < y.
+ */
+inline bool LimbAbsDiff(Limb* r, const Limb* x, size_t nx, const Limb* y, size_t ny);
+
+// ===== SHIFTS =====
+/**
+ * @brief r = a << shift over n limbs, 0 < shift < 64. Returns the bits shifted out, in the low bits.
+ */
+inline Limb LimbShiftLeft(Limb* r, const Limb* a, size_t n, unsigned shift);
+
+/**
+ * @brief r = a >> shift over n limbs, 0 < shift < 64. Returns the bits shifted out, in the high bits.
+ */
+inline Limb LimbShiftRight(Limb* r, const Limb* a, size_t n, unsigned shift);
+
+/**
+ * @brief a >>= shift in place over n limbs for any shift; shifts of 64n or more clear a.
+ */
+inline void LimbShiftRightBits(Limb* a, size_t n, size_t shift);
+
+/**
+ * @brief r = a << shift over n limbs for an na-limb a whose shifted value fits in r. r may alias a.
+ */
+inline void LimbShiftLeftBits(Limb* r, size_t n, const Limb* a, size_t na, size_t shift);
+
+/**
+ * @brief Number of leading zero bits of an n-limb value; 64n for zero.
+ */
+inline size_t LimbCountLeadingZeros(const Limb* a, size_t n);
+
+/**
+ * @brief True when any of the low count bits of an n-limb value is set (count may exceed 64n).
+ * Used as the sticky bit when a value is shifted right.
+ */
+inline bool LimbTestLowBits(const Limb* a, size_t n, size_t count);
+
+// ===== BIT REVERSAL =====
+/**
+ * @brief Reverses the order of the 64 bits of a limb.
+ */
+inline Limb LimbReverseBits(Limb a);
+
+/**
+ * @brief r = a with the order of all its 64n bits reversed, so r[i] = LimbReverseBits(a[n - 1 - i]).
+ * Uses a pshufb nibble lookup when SSSE3 is available. r may alias a.
+ */
+inline void LimbReverseBitsN(Limb* r, const Limb* a, size_t n);
+
+// ===== MULTIPLICATION =====
+/**
+ * @brief Balanced products switch from schoolbook to Karatsuba at this many limbs.
+ */
+inline constexpr size_t LimbKaratsubaThreshold = 20;
+
+/**
+ * @brief Balanced products switch from Karatsuba to Toom-3 at this many limbs.
+ */
+inline constexpr size_t LimbToom3Threshold = 128;
+
+/**
+ * @brief r = a * b where b is a single limb. Returns the high limb of the product.
+ */
+inline Limb LimbMul1(Limb* r, const Limb* a, size_t n, Limb b);
+
+/**
+ * @brief r += a * b where b is a single limb. Returns the limb carried out of r[n - 1].
+ */
+inline Limb LimbAddMul1(Limb* r, const Limb* a, size_t n, Limb b);
+
+/**
+ * @brief r = a * b, r has na + nb limbs and must not alias a or b.
+ */
+inline void LimbMulSchoolbook(Limb* r, const Limb* a, size_t na, const Limb* b, size_t nb);
+
+/**
+ * @brief Low n limbs of a * b (wrapping product). r must not alias a or b.
+ */
+inline void LimbMulLow(Limb* r, const Limb* a, const Limb* b, size_t n);
+
+/**
+ * @brief Scratch limbs needed by LimbMul for an n x n product.
+ */
+constexpr size_t LimbMulScratchSize(size_t n);
+
+/**
+ * @brief r = a * b for two n-limb values, picking schoolbook, Karatsuba or Toom-3 by size.
+ * r has 2n limbs and must not alias a or b; scratch holds LimbMulScratchSize(n) limbs.
+ */
+inline void LimbMul(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief Karatsuba n x n product. Same contract as LimbMul.
+ */
+inline void LimbMulKaratsuba(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief Toom-3 n x n product (points 0, 1, -1, -2, inf). Same contract as LimbMul; needs n >= 5.
+ */
+inline void LimbMulToom3(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief r = a * b for two n-limb values with the tier picked at compile time and the scratch
+ * space on the stack. r has 2n limbs and must not alias a or b.
+ */
+template<size_t n>
+void LimbMulFixed(Limb* r, const Limb* a, const Limb* b);
+
+/**
+ * @brief Low n limbs of a * b with the tier picked at compile time. r must not alias a or b.
+ */
+template<size_t n>
+void LimbMulLowFixed(Limb* r, const Limb* a, const Limb* b);
+
+/**
+ * @brief r = a / 3 for an a known to be a multiple of 3. Works modulo 2^(64n), so two's
+ * complement values are divided exactly as well.
+ */
+inline void LimbDivExact3(Limb* r, const Limb* a, size_t n);
+
+// ===== DIVISION =====
+/**
+ * @brief (high * 2^64 + low) / d for high < d. Returns the quotient and writes the remainder.
+ */
+inline Limb LimbDivWide(Limb high, Limb low, Limb d, Limb& remainder);
+
+/**
+ * @brief floor((2^128 - 1) / d) - 2^64 for a normalized d (top bit set).
+ */
+inline Limb LimbReciprocal(Limb d);
+
+/**
+ * @brief (high * 2^64 + low) / d for a normalized d with its reciprocal, high < d.
+ * Returns the quotient and writes the remainder.
+ */
+inline Limb LimbDivPreinv(Limb high, Limb low, Limb d, Limb reciprocal, Limb& remainder);
+
+/**
+ * @brief r -= a * b where b is a single limb. Returns the limb borrowed out of r[n - 1].
+ */
+inline Limb LimbSubMul1(Limb* r, const Limb* a, size_t n, Limb b);
+
+/**
+ * @brief q = a / d over n limbs for a single-limb d != 0. Returns the remainder; q may alias a.
+ */
+inline Limb LimbDivRem1(Limb* q, const Limb* a, size_t n, Limb d);
+
+/**
+ * @brief Scratch limbs needed by LimbDivRem for an m-limb dividend and an n-limb divisor.
+ */
+constexpr size_t LimbDivRemScratchSize(size_t m, size_t n) {
+    return m + 1 + n;
+}
+
+/**
+ * @brief Knuth's Algorithm D. u has m limbs, v has n >= 2 limbs with v[n - 1] != 0 and m >= n.
+ * q receives m - n + 1 limbs and r receives n limbs. Neither may alias the inputs.
+ */
+inline void LimbDivRemKnuth(Limb* q, Limb* r, const Limb* u, size_t m, const Limb* v, size_t n, Limb* scratch);
+
+/**
+ * @brief q = u / v and r = u % v for an m-limb u and an n-limb v != 0 (leading zero limbs allowed).
+ * q receives m limbs and r receives n limbs, zero-filled above the result.
+ * Picks the single-limb path when the divisor fits in one limb.
+ */
+inline void LimbDivRem(Limb* q, Limb* r, const Limb* u, size_t m, const Limb* v, size_t n, Limb* scratch);
+
+// ===== GCD =====
+/**
+ * @brief LimbGcd switches from binary GCD to Lehmer's algorithm at this many limbs.
+ */
+inline constexpr size_t LimbGcdLehmerThreshold = 2;
+
+/**
+ * @brief Number of trailing zero bits of an n-limb value; 64n when it is zero.
+ */
+inline size_t LimbCountTrailingZeros(const Limb* a, size_t n);
+
+/**
+ * @brief Scratch limbs needed by LimbGcdBinary, LimbGcdLehmer and LimbGcd for n-limb operands.
+ */
+constexpr size_t LimbGcdScratchSize(size_t n) {
+    return 4 * n + 1;
+}
+
+/**
+ * @brief r = gcd(a, b) over n limbs by Stein's binary algorithm: strip the common power of two,
+ * then subtract and shift out trailing zeros. Operands whose lengths drift apart by more than a
+ * limb are brought together with one division first.
+ * a and b are overwritten; r may alias either of them.
+ */
+inline void LimbGcdBinary(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief r = gcd(a, b) over n limbs by Lehmer's algorithm (Knuth's Algorithm L). The Euclidean
+ * quotients are run on the leading 62 bits in single precision, and the gathered 2x2 cofactor
+ * matrix is applied to the full operands in one pass, so each pass retires about 30 bits.
+ * a and b are overwritten; r may alias either of them.
+ */
+inline void LimbGcdLehmer(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief r = gcd(a, b) over n limbs, picking the binary or the Lehmer kernel by size.
+ * a and b are overwritten; r may alias either of them. gcd(0, 0) = 0.
+ */
+inline void LimbGcd(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch);
+
+/**
+ * @brief Scratch limbs needed by LimbGcdExtended for n-limb operands.
+ */
+constexpr size_t LimbGcdExtendedScratchSize(size_t n) {
+    return 16 * n + 1;
+}
+
+/**
+ * @brief g = gcd(a, b) with Bezout coefficients x and y such that a * x + b * y = g, by Lehmer's
+ * algorithm with the cofactors carried along. x and y are written in n-limb two's complement;
+ * |x| <= max(b / 2g, 1) and |y| <= max(a / 2g, 1), so the top bit carries the sign whenever
+ * n limbs hold a and b. None of g, x and y may alias a or b.
+ */
+inline void LimbGcdExtended(Limb* g, Limb* x, Limb* y, const Limb* a, const Limb* b, size_t n, Limb* scratch);
+
+// ===== MONTGOMERY ARITHMETIC =====
+/**
+ * @brief -m^-1 mod 2^64 for an odd m, by Newton iteration.
+ */
+constexpr Limb LimbMontgomeryInverse(Limb m);
+
+/**
+ * @brief Scratch limbs needed by LimbMontgomeryMul and LimbMontgomerySqr for an n-limb modulus.
+ */
+constexpr size_t LimbMontgomeryScratchSize(size_t n) {
+    return 2 * n + 1;
+}
+
+/**
+ * @brief r = a * b / 2^(64n) mod m by coarsely integrated operand scanning (CIOS), for an odd
+ * n-limb m with inverse = LimbMontgomeryInverse(m[0]) and a * b < 2^(64n) * m.
+ * r < m on return and may alias a or b; scratch holds LimbMontgomeryScratchSize(n) limbs.
+ * Runs in constant time: the final subtraction of m is always done and masked in.
+ */
+inline void LimbMontgomeryMul(Limb* r, const Limb* a, const Limb* b, const Limb* m, size_t n, Limb inverse, Limb* scratch);
+
+/**
+ * @brief r = a * a / 2^(64n) mod m. Forms the square with the cross products counted once, then
+ * reduces it, which is about a quarter cheaper than LimbMontgomeryMul. Same contract otherwise.
+ */
+inline void LimbMontgomerySqr(Limb* r, const Limb* a, const Limb* m, size_t n, Limb inverse, Limb* scratch);
+
+// ===== CONSTANT TIME =====
+/**
+ * @brief Hides x from the optimizer so masks built from it are not turned back into branches.
+ */
+inline Limb LimbCtBarrier(Limb x);
+
+/**
+ * @brief All ones for bit = 1, zero for bit = 0.
+ */
+inline Limb LimbCtMask(Limb bit);
+
+/**
+ * @brief 1 if x != 0, else 0, without a branch.
+ */
+inline Limb LimbCtIsNonZero(Limb x);
+
+/**
+ * @brief r = mask ? a : b limb by limb for an all-ones or all-zero mask. r may alias a or b.
+ */
+inline void LimbCtSelect(Limb* r, const Limb* a, const Limb* b, size_t n, Limb mask);
+
+/**
+ * @brief Swaps a and b when mask is all ones, leaves them when it is zero; same work either way.
+ */
+inline void LimbCtSwap(Limb* a, Limb* b, size_t n, Limb mask);
+
+/**
+ * @brief 1 if a == b over n limbs, else 0, reading every limb.
+ */
+inline Limb LimbCtEqual(const Limb* a, const Limb* b, size_t n);
+
+/**
+ * @brief Sign of a - b over n limbs (-1, 0, 1) from a full borrow chain instead of an early exit.
+ */
+inline int LimbCtCompare(const Limb* a, const Limb* b, size_t n);
+
+/**
+ * @brief r = table[index] for a table of count entries of n limbs each, reading every entry so the
+ * access pattern does not depend on index.
+ */
+inline void LimbCtLookup(Limb* r, const Limb* table, size_t count, size_t n, size_t index);
+
+// ===== RADIX CONVERSION =====
+/**
+ * @brief Largest power of a base that fits in one limb, and its number of digits.
+ */
+struct LimbRadix {
+    Limb power;
+    size_t digits;
+};
+
+/**
+ * @brief LimbRadix for base in [2, 36]. Base 10 gives 10^19.
+ */
+constexpr LimbRadix LimbRadixFor(unsigned base);
+
+/**
+ * @brief Limb counts from which formatting (4096 bits) and parsing (8192 bits) switch to divide-and-conquer.
+ */
+inline constexpr size_t LimbRadixThreshold = 64;
+inline constexpr size_t LimbRadixParseThreshold = 128;
+
+/**
+ * @brief Value of a digit character ('0'-'9', 'a'-'z', 'A'-'Z'), or 255 when it is not one.
+ */
+constexpr uint8_t LimbDigitValue(char c);
+
+/**
+ * @brief log2(base) for the power-of-two bases 2, 4, 8, 16 and 32, or 0 for any other base.
+ */
+constexpr unsigned LimbPow2DigitBits(unsigned base);
+
+/**
+ * @brief Writes the 16n uppercase hex digits of a, most significant first. SSE2 when available.
+ */
+inline void LimbHexEncode(char* out, const Limb* a, size_t n);
+
+/**
+ * @brief Reads 16n hex digits (either case, most significant first) into r.
+ * Returns false when a character is not a hex digit. SSE2 when available.
+ */
+inline bool LimbHexDecode(Limb* r, const char* in, size_t n);
+
+/**
+ * @brief Writes exactly width digits of a (n limbs) ending at out + width, zero-padded,
+ * by slicing bitsPerDigit-bit groups straight out of the limbs.
+ */
+inline void LimbToDigitsPow2(char* out, size_t width, const Limb* a, size_t n, unsigned bitsPerDigit);
+
+/**
+ * @brief Packs digits of bitsPerDigit bits each into r (n limbs), dropping bits past 64n.
+ * Returns false when a character is not a digit of the base.
+ */
+inline bool LimbFromDigitsPow2(Limb* r, size_t n, std::string_view digits, unsigned bitsPerDigit);
+
+/**
+ * @brief Formats the n-limb value a in base [2, 36], most significant digit first, uppercase letters.
+ * Zero formats as "0". Power-of-two bases go through LimbToDigitsPow2.
+ */
+inline std::string LimbToString(const Limb* a, size_t n, unsigned base);
+
+/**
+ * @brief Parses digits in base [2, 36] into r (n limbs), keeping the value modulo 2^(64n).
+ * Returns false, leaving r unspecified, when a character is not a digit of the base.
+ * Power-of-two bases go through LimbFromDigitsPow2.
+ */
+inline bool LimbFromString(Limb* r, size_t n, std::string_view digits, unsigned base);
+
+// ===== CHECKSUMS AND HASHING =====
+/**
+ * @brief CRC32C (Castagnoli) of length bytes, continuing from a previous result crc (0 to start).
+ * Uses the SSE4.2 crc32 instruction when the CPU has it, slice-by-8 tables otherwise.
+ */
+inline uint32_t LimbCrc32c(const uint8_t* data, size_t length, uint32_t crc = 0);
+
+/**
+ * @brief Fast non-cryptographic 64-bit hash of length bytes (wyhash).
+ */
+inline uint64_t LimbHashBytes(const uint8_t* data, size_t length, uint64_t seed = 0);
+
+/**
+ * @brief LimbHashBytes over n limbs produced by limbAt(i), so callers can mask or
+ * canonicalize words on the fly instead of copying them out first.
+ */
+template<typename LimbSource>
+uint64_t LimbHashLimbs(LimbSource&& limbAt, size_t n, uint64_t seed = 0);
+
+#include <core/limb/impl/LimbEngineImpl.h>
+
+#endif //LIMBENGINE_H
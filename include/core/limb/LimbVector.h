@@ -0,0 +1,125 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMBVECTOR_H
+#define LIMBVECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <core/limb/LimbEngine.h>
+
+/**
+ * @brief Growable limb array that keeps up to inlineCapacity limbs in place and spills to the heap
+ * beyond that.
+ *
+ * Values up to 512 bits never allocate; wider ones allocate once and steal the heap block on move.
+ * New limbs are always zero.
+ */
+class LimbVector {
+public:
+    static constexpr size_t inlineCapacity = 8;
+
+    LimbVector() = default;
+    explicit LimbVector(size_t count) {
+        resize(count);
+    }
+    LimbVector(const LimbVector& other) {
+        resize(other.size_);
+        std::copy(other.begin(), other.end(), data_);
+    }
+    LimbVector(LimbVector&& other) noexcept {
+        *this = std::move(other);
+    }
+    ~LimbVector() {
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+    }
+
+    LimbVector& operator=(const LimbVector& other) {
+        if (this != &other) {
+            resize(other.size_);
+            std::copy(other.begin(), other.end(), data_);
+        }
+        return *this;
+    }
+    LimbVector& operator=(LimbVector&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+        if (other.data_ != other.inline_) {
+            // Steal the heap block and leave other empty
+            if (data_ != inline_) {
+                delete[] data_;
+            }
+            data_ = std::exchange(other.data_, other.inline_);
+            capacity_ = std::exchange(other.capacity_, inlineCapacity);
+            size_ = std::exchange(other.size_, 0);
+        }
+        else {
+            // Inline limbs have to be copied; keep whatever buffer this already has
+            size_ = other.size_;
+            std::copy(other.begin(), other.end(), data_);
+        }
+        return *this;
+    }
+
+    Limb& operator[](size_t index) {
+        return data_[index];
+    }
+    const Limb& operator[](size_t index) const {
+        return data_[index];
+    }
+    Limb* data() {
+        return data_;
+    }
+    const Limb* data() const {
+        return data_;
+    }
+    Limb* begin() {
+        return data_;
+    }
+    const Limb* begin() const {
+        return data_;
+    }
+    Limb* end() {
+        return data_ + size_;
+    }
+    const Limb* end() const {
+        return data_ + size_;
+    }
+    size_t size() const {
+        return size_;
+    }
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Grows or shrinks to count limbs; limbs that come into view are zero
+    void resize(size_t count) {
+        if (count > capacity_) {
+            Limb* grown = new Limb[count];
+            std::copy(data_, data_ + size_, grown);
+            if (data_ != inline_) {
+                delete[] data_;
+            }
+            data_ = grown;
+            capacity_ = count;
+        }
+        if (count > size_) {
+            std::fill(data_ + size_, data_ + count, Limb{0});
+        }
+        size_ = count;
+    }
+
+private:
+    Limb inline_[inlineCapacity] = {};
+    Limb* data_ = inline_;
+    size_t size_ = 0;
+    size_t capacity_ = inlineCapacity;
+};
+
+#endif //LIMBVECTOR_H
@@ -0,0 +1,21 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMBENGINEIMPL_H
+#define LIMBENGINEIMPL_H
+
+#include <core/limb/impl/intrinsics.inl>
+#include <core/limb/impl/add_sub.inl>
+#include <core/limb/impl/shift.inl>
+#include <core/limb/impl/bit_reverse.inl>
+#include <core/limb/impl/multiplication.inl>
+#include <core/limb/impl/division.inl>
+#include <core/limb/impl/gcd.inl>
+#include <core/limb/impl/constant_time.inl>
+#include <core/limb/impl/montgomery.inl>
+#include <core/limb/impl/radix.inl>
+#include <core/limb/impl/radix_pow2.inl>
+#include <core/limb/impl/hash.inl>
+
+#endif //LIMBENGINEIMPL_H
@@ -0,0 +1,95 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_ADD_SUB_INL
+#define LIMB_ADD_SUB_INL
+
+inline bool LimbAddN(Limb* r, const Limb* a, const Limb* b, size_t n, bool carry) {
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = LimbAddCarry(a[i], b[i], carry);
+    }
+    return carry;
+}
+
+inline bool LimbSubN(Limb* r, const Limb* a, const Limb* b, size_t n, bool borrow) {
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = LimbSubBorrow(a[i], b[i], borrow);
+    }
+    return borrow;
+}
+
+inline bool LimbAdd1(Limb* r, const Limb* a, size_t n, Limb b) {
+    size_t i = 0;
+    for (; i < n && b != 0; ++i) {
+        const Limb sum = a[i] + b;
+        b = sum < b;
+        r[i] = sum;
+    }
+    if (r != a) {
+        for (; i < n; ++i) {
+            r[i] = a[i];
+        }
+    }
+    return b != 0;
+}
+
+inline bool LimbSub1(Limb* r, const Limb* a, size_t n, Limb b) {
+    size_t i = 0;
+    for (; i < n && b != 0; ++i) {
+        const Limb diff = a[i] - b;
+        b = a[i] < b;
+        r[i] = diff;
+    }
+    if (r != a) {
+        for (; i < n; ++i) {
+            r[i] = a[i];
+        }
+    }
+    return b != 0;
+}
+
+inline void LimbNeg(Limb* r, const Limb* a, size_t n) {
+    bool borrow = false;
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = LimbSubBorrow(0, a[i], borrow);
+    }
+}
+
+inline int LimbCompare(const Limb* a, const Limb* b, size_t n) {
+    for (size_t i = n; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+inline bool LimbAbsDiff(Limb* r, const Limb* x, size_t nx, const Limb* y, size_t ny) {
+    // x is zero-extended to ny limbs
+    bool xLess = false;
+    size_t top = ny;
+    while (top > nx && y[top - 1] == 0) {
+        --top;
+    }
+    if (top > nx) {
+        xLess = true;
+    }
+    else {
+        xLess = LimbCompare(x, y, nx) < 0;
+    }
+
+    if (xLess) {
+        const bool borrow = LimbSubN(r, y, x, nx);
+        LimbSub1(r + nx, y + nx, ny - nx, borrow);
+    }
+    else {
+        LimbSubN(r, x, y, nx);
+        for (size_t i = nx; i < ny; ++i) {
+            r[i] = 0;
+        }
+    }
+    return xLess;
+}
+
+#endif //LIMB_ADD_SUB_INL
@@ -0,0 +1,55 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_BIT_REVERSE_INL
+#define LIMB_BIT_REVERSE_INL
+
+inline Limb LimbReverseBits(Limb a) {
+#if LIMB_HAS_BUILTIN(__builtin_bitreverse64)
+    return __builtin_bitreverse64(a);
+#else
+    // Reverse the bytes, then the bits inside every byte
+    a = __builtin_bswap64(a);
+    a = ((a >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((a & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    a = ((a >> 2) & 0x3333333333333333ULL) | ((a & 0x3333333333333333ULL) << 2);
+    a = ((a >> 1) & 0x5555555555555555ULL) | ((a & 0x5555555555555555ULL) << 1);
+    return a;
+#endif
+}
+
+#if defined(__SSSE3__)
+// Reverses all 128 bits of a vector: pshufb reverses the bytes, then looks up both nibbles of every byte
+inline __m128i LimbReverseBits128(__m128i v) {
+    const __m128i byteOrder = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i reversedNibbles = _mm_set_epi8(15, 7, 11, 3, 13, 5, 9, 1, 14, 6, 10, 2, 12, 4, 8, 0);
+    const __m128i reversedNibblesHigh = _mm_slli_epi16(reversedNibbles, 4);
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+    v = _mm_shuffle_epi8(v, byteOrder);
+    const __m128i low = _mm_and_si128(v, lowMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), lowMask);
+    return _mm_or_si128(_mm_shuffle_epi8(reversedNibblesHigh, low), _mm_shuffle_epi8(reversedNibbles, high));
+}
+#endif
+
+inline void LimbReverseBitsN(Limb* r, const Limb* a, size_t n) {
+    // Work inwards from both ends, reading each pair before writing it, so r may alias a
+    size_t low = 0;
+    size_t high = n;
+#if defined(__SSSE3__)
+    for (; high - low >= 4; low += 2, high -= 2) {
+        const __m128i lowPair = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + low));
+        const __m128i highPair = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + high - 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + low), LimbReverseBits128(highPair));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r + high - 2), LimbReverseBits128(lowPair));
+    }
+#endif
+    for (; low < high; ++low, --high) {
+        const Limb lowLimb = a[low];
+        const Limb highLimb = a[high - 1];
+        r[low] = LimbReverseBits(highLimb);
+        r[high - 1] = LimbReverseBits(lowLimb);
+    }
+}
+
+#endif //LIMB_BIT_REVERSE_INL
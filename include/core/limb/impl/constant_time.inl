@@ -0,0 +1,70 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_CONSTANT_TIME_INL
+#define LIMB_CONSTANT_TIME_INL
+
+inline Limb LimbCtBarrier(Limb x) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__("" : "+r"(x));
+    return x;
+#else
+    volatile Limb hidden = x;
+    return hidden;
+#endif
+}
+
+inline Limb LimbCtMask(Limb bit) {
+    return Limb{0} - LimbCtBarrier(bit);
+}
+
+inline Limb LimbCtIsNonZero(Limb x) {
+    // The top bit of x | -x is set exactly when x != 0
+    return (x | (Limb{0} - x)) >> (LimbBits - 1);
+}
+
+inline void LimbCtSelect(Limb* r, const Limb* a, const Limb* b, size_t n, Limb mask) {
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = b[i] ^ ((a[i] ^ b[i]) & mask);
+    }
+}
+
+inline void LimbCtSwap(Limb* a, Limb* b, size_t n, Limb mask) {
+    for (size_t i = 0; i < n; ++i) {
+        const Limb difference = (a[i] ^ b[i]) & mask;
+        a[i] ^= difference;
+        b[i] ^= difference;
+    }
+}
+
+inline Limb LimbCtEqual(const Limb* a, const Limb* b, size_t n) {
+    Limb difference = 0;
+    for (size_t i = 0; i < n; ++i) {
+        difference |= a[i] ^ b[i];
+    }
+    return LimbCtIsNonZero(difference) ^ 1;
+}
+
+inline int LimbCtCompare(const Limb* a, const Limb* b, size_t n) {
+    Limb difference = 0;
+    bool borrow = false;
+    for (size_t i = 0; i < n; ++i) {
+        difference |= LimbSubBorrow(a[i], b[i], borrow);
+    }
+    // 1 - 2 = -1 when a < b, 1 - 0 = 1 when a > b, 0 - 0 when equal
+    return static_cast<int>(LimbCtIsNonZero(difference)) - 2 * static_cast<int>(borrow);
+}
+
+inline void LimbCtLookup(Limb* r, const Limb* table, size_t count, size_t n, size_t index) {
+    std::fill(r, r + n, Limb{0});
+    for (size_t entry = 0; entry < count; ++entry) {
+        const Limb mask = LimbCtMask(LimbCtIsNonZero(entry ^ index) ^ 1);
+        const Limb* row = table + entry * n;
+        for (size_t i = 0; i < n; ++i) {
+            r[i] |= row[i] & mask;
+        }
+    }
+}
+
+#endif //LIMB_CONSTANT_TIME_INL
@@ -0,0 +1,196 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_DIVISION_INL
+#define LIMB_DIVISION_INL
+
+inline Limb LimbDivWide(Limb high, Limb low, Limb d, Limb& remainder) {
+#if (defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)))
+    Limb quotient;
+    // volatile: divq traps on a zero divisor or quotient overflow, so it must not be hoisted onto paths that skip it
+    __asm__ volatile("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(low), "d"(high), "rm"(d));
+    return quotient;
+#elif defined(_M_X64) && defined(_MSC_VER)
+    unsigned long long rem;
+    const Limb quotient = _udiv128(high, low, d, &rem);
+    remainder = rem;
+    return quotient;
+#elif defined(__SIZEOF_INT128__)
+    const unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+    remainder = static_cast<Limb>(dividend % d);
+    return static_cast<Limb>(dividend / d);
+#else
+    // Bit-serial fallback
+    Limb quotient = 0;
+    for (int i = 63; i >= 0; --i) {
+        const bool top = (high >> 63) != 0;
+        high = (high << 1) | (low >> 63);
+        low <<= 1;
+        quotient <<= 1;
+        if (top || high >= d) {
+            high -= d;
+            quotient |= 1;
+        }
+    }
+    remainder = high;
+    return quotient;
+#endif
+}
+
+inline Limb LimbReciprocal(Limb d) {
+    Limb remainder;
+    return LimbDivWide(~d, ~Limb{0}, d, remainder);
+}
+
+inline Limb LimbDivPreinv(Limb high, Limb low, Limb d, Limb reciprocal, Limb& remainder) {
+    // Möller and Granlund, "Improved division by invariant integers", Algorithm 4
+    Limb quotientHigh;
+    Limb quotientLow = LimbMulWide(reciprocal, high, quotientHigh);
+    quotientLow += low;
+    quotientHigh += high + 1 + (quotientLow < low);
+
+    Limb rest = low - quotientHigh * d;
+    if (rest > quotientLow) {
+        --quotientHigh;
+        rest += d;
+    }
+    if (rest >= d) {
+        ++quotientHigh;
+        rest -= d;
+    }
+    remainder = rest;
+    return quotientHigh;
+}
+
+inline Limb LimbSubMul1(Limb* r, const Limb* a, size_t n, Limb b) {
+    Limb borrow = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Limb high;
+        Limb low = LimbMulWide(a[i], b, high);
+        low += borrow;
+        high += low < borrow;
+        const Limb current = r[i];
+        r[i] = current - low;
+        high += current < low;
+        borrow = high;
+    }
+    return borrow;
+}
+
+inline Limb LimbDivRem1(Limb* q, const Limb* a, size_t n, Limb d) {
+    // Normalize the divisor and shift the dividend on the fly
+    const unsigned shift = std::countl_zero(d);
+    const Limb divisor = d << shift;
+    const Limb reciprocal = LimbReciprocal(divisor);
+
+    Limb remainder = 0;
+    if (shift == 0) {
+        for (size_t i = n; i-- > 0;) {
+            q[i] = LimbDivPreinv(remainder, a[i], divisor, reciprocal, remainder);
+        }
+        return remainder;
+    }
+
+    Limb previous = 0;
+    for (size_t i = n; i-- > 0;) {
+        const Limb current = a[i];
+        const Limb shifted = (previous << shift) | (current >> (LimbBits - shift));
+        previous = current;
+        // q[i + 1] is produced from the limb that straddles a[i + 1] and a[i]
+        const Limb digit = LimbDivPreinv(remainder, shifted, divisor, reciprocal, remainder);
+        if (i + 1 < n) {
+            q[i + 1] = digit;
+        }
+    }
+    q[0] = LimbDivPreinv(remainder, previous << shift, divisor, reciprocal, remainder);
+    return remainder >> shift;
+}
+
+inline void LimbDivRemKnuth(Limb* q, Limb* r, const Limb* u, size_t m, const Limb* v, size_t n, Limb* scratch) {
+    // D1: normalize so the divisor's top limb has its high bit set
+    const unsigned shift = std::countl_zero(v[n - 1]);
+    Limb* un = scratch;
+    Limb* vn = scratch + m + 1;
+    if (shift == 0) {
+        std::memcpy(un, u, m * sizeof(Limb));
+        un[m] = 0;
+        std::memcpy(vn, v, n * sizeof(Limb));
+    }
+    else {
+        un[m] = LimbShiftLeft(un, u, m, shift);
+        LimbShiftLeft(vn, v, n, shift);
+    }
+
+    const Limb top = vn[n - 1];
+    const Limb second = vn[n - 2];
+    const Limb reciprocal = LimbReciprocal(top);
+
+    for (size_t j = m - n + 1; j-- > 0;) {
+        // D3: estimate the quotient digit from the top two limbs and refine it with the third
+        Limb qhat;
+        Limb rhat;
+        bool refine = true;
+        if (un[j + n] >= top) {
+            qhat = ~Limb{0};
+            rhat = un[j + n - 1] + top;
+            refine = rhat >= top; // rhat overflowed past one limb: qhat is already close enough
+        }
+        else {
+            qhat = LimbDivPreinv(un[j + n], un[j + n - 1], top, reciprocal, rhat);
+        }
+        while (refine) {
+            Limb productHigh;
+            const Limb productLow = LimbMulWide(qhat, second, productHigh);
+            if (productHigh < rhat || (productHigh == rhat && productLow <= un[j + n - 2])) {
+                break;
+            }
+            --qhat;
+            rhat += top;
+            refine = rhat >= top;
+        }
+
+        // D4: multiply and subtract; D6: add back on the rare overshoot
+        const Limb borrow = LimbSubMul1(un + j, vn, n, qhat);
+        const Limb current = un[j + n];
+        un[j + n] = current - borrow;
+        if (current < borrow) {
+            --qhat;
+            un[j + n] += LimbAddN(un + j, un + j, vn, n);
+        }
+        q[j] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    if (shift == 0) {
+        std::memcpy(r, un, n * sizeof(Limb));
+    }
+    else {
+        LimbShiftRight(r, un, n, shift);
+        r[n - 1] |= un[n] << (LimbBits - shift);
+    }
+}
+
+inline void LimbDivRem(Limb* q, Limb* r, const Limb* u, size_t m, const Limb* v, size_t n, Limb* scratch) {
+    std::memset(q, 0, m * sizeof(Limb));
+    std::memset(r, 0, n * sizeof(Limb));
+    while (n > 0 && v[n - 1] == 0) {
+        --n;
+    }
+    while (m > 0 && u[m - 1] == 0) {
+        --m;
+    }
+
+    if (m < n || (m == n && LimbCompare(u, v, n) < 0)) {
+        // u < v
+        std::memcpy(r, u, m * sizeof(Limb));
+        return;
+    }
+    if (n == 1) {
+        r[0] = LimbDivRem1(q, u, m, v[0]);
+        return;
+    }
+    LimbDivRemKnuth(q, r, u, m, v, n, scratch);
+}
+
+#endif //LIMB_DIVISION_INL
@@ -0,0 +1,291 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_GCD_INL
+#define LIMB_GCD_INL
+
+inline size_t LimbActiveLength(const Limb* a, size_t n) {
+    while (n > 0 && a[n - 1] == 0) {
+        --n;
+    }
+    return n;
+}
+
+inline size_t LimbCountTrailingZeros(const Limb* a, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i] != 0) {
+            return i * LimbBits + std::countr_zero(a[i]);
+        }
+    }
+    return n * LimbBits;
+}
+
+inline Limb LimbGcdWord(Limb a, Limb b) {
+    if (a == 0 || b == 0) {
+        return a | b;
+    }
+    const int common = std::countr_zero(a | b);
+    a >>= std::countr_zero(a);
+    while (b != 0) {
+        b >>= std::countr_zero(b);
+        if (a > b) {
+            std::swap(a, b);
+        }
+        b -= a;
+    }
+    return a << common;
+}
+
+inline void LimbGcdBinary(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch) {
+    size_t na = LimbActiveLength(a, n);
+    size_t nb = LimbActiveLength(b, n);
+    if (na == 0 || nb == 0) {
+        const Limb* other = na == 0 ? b : a;
+        std::memmove(r, other, n * sizeof(Limb));
+        return;
+    }
+
+    const size_t aZeros = LimbCountTrailingZeros(a, na);
+    const size_t bZeros = LimbCountTrailingZeros(b, nb);
+    const size_t common = std::min(aZeros, bZeros);
+    LimbShiftRightBits(a, na, aZeros);
+    na = LimbActiveLength(a, na);
+    LimbShiftRightBits(b, nb, bZeros);
+    nb = LimbActiveLength(b, nb);
+
+    // Both odd from here on; the subtraction of two odd values leaves at least one zero to shift out
+    Limb* quotient = scratch;
+    Limb* remainder = scratch + n;
+    while (true) {
+        if (na < nb || (na == nb && LimbCompare(a, b, na) < 0)) {
+            std::swap(a, b);
+            std::swap(na, nb);
+        }
+        if (na == 1) {
+            a[0] = LimbGcdWord(a[0], b[0]);
+            break;
+        }
+        if (na > nb + 1) {
+            // Subtraction would take a limb's worth of rounds to close the gap; divide instead
+            LimbDivRem(quotient, remainder, a, na, b, nb, scratch + 2 * n);
+            std::memcpy(a, remainder, nb * sizeof(Limb));
+            std::memset(a + nb, 0, (na - nb) * sizeof(Limb));
+        }
+        else {
+            const bool borrow = LimbSubN(a, a, b, nb);
+            LimbSub1(a + nb, a + nb, na - nb, borrow);
+        }
+        na = LimbActiveLength(a, na);
+        if (na == 0) {
+            a = b;
+            na = nb;
+            break;
+        }
+        LimbShiftRightBits(a, na, LimbCountTrailingZeros(a, na));
+        na = LimbActiveLength(a, na);
+    }
+    LimbShiftLeftBits(r, n, a, na, common);
+}
+
+// Leading 62 bits of x, cut at the bit where the nu-limb u has its top bit after shifting left by shift
+inline int64_t LimbLehmerWindow(const Limb* x, size_t nu, unsigned shift) {
+    Limb window = x[nu - 1] << shift;
+    if (shift > 0 && nu > 1) {
+        window |= x[nu - 2] >> (LimbBits - shift);
+    }
+    return static_cast<int64_t>(window >> 2);
+}
+
+// Knuth's steps L2 and L3: runs the Euclidean quotients on uHat >= vHat while both bounds agree, so
+// each quotient is the one the full operands would give. Writes the cofactor matrix {A, B, C, D}
+// with u' = A u + B v and v' = C u + D v, and returns the number of quotients taken. Every
+// magnitude stays below 2^62, so the sums cannot overflow.
+inline size_t LimbLehmerMatrix(int64_t uHat, int64_t vHat, int64_t (&matrix)[4]) {
+    int64_t a = 1;
+    int64_t b = 0;
+    int64_t c = 0;
+    int64_t d = 1;
+    size_t steps = 0;
+    while (vHat + c > 0 && vHat + d > 0) {
+        const int64_t q = (uHat + a) / (vHat + c);
+        if (q != (uHat + b) / (vHat + d)) {
+            break;
+        }
+        int64_t t = a - q * c;
+        a = c;
+        c = t;
+        t = b - q * d;
+        b = d;
+        d = t;
+        t = uHat - q * vHat;
+        uHat = vHat;
+        vHat = t;
+        ++steps;
+    }
+    matrix[0] = a;
+    matrix[1] = b;
+    matrix[2] = c;
+    matrix[3] = d;
+    return steps;
+}
+
+// r = x u + y v over n limbs for a matrix row (x, y) of opposite signs whose result is known to be
+// non-negative and to fit in n limbs
+inline void LimbLehmerCombine(Limb* r, const Limb* u, const Limb* v, size_t n, int64_t x, int64_t y) {
+    if (y <= 0) {
+        LimbMul1(r, u, n, static_cast<Limb>(x));
+        LimbSubMul1(r, v, n, static_cast<Limb>(-y));
+    }
+    else {
+        LimbMul1(r, v, n, static_cast<Limb>(y));
+        LimbSubMul1(r, u, n, static_cast<Limb>(-x));
+    }
+}
+
+// r = |x| s + |y| t over n limbs. Cofactor rows alternate in sign and so do the matrix entries, so
+// the two terms of a new cofactor always share a sign and only their magnitudes need tracking.
+inline void LimbLehmerCombineMagnitudes(Limb* r, const Limb* s, const Limb* t, size_t n, int64_t x, int64_t y) {
+    LimbMul1(r, s, n, static_cast<Limb>(x < 0 ? -x : x));
+    LimbAddMul1(r, t, n, static_cast<Limb>(y < 0 ? -y : y));
+}
+
+inline void LimbGcdLehmer(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch) {
+    Limb* u = a;
+    Limb* v = b;
+    Limb* t = scratch;
+    Limb* w = scratch + n;
+    Limb* divisionScratch = scratch + 2 * n;
+    size_t nu = LimbActiveLength(u, n);
+    size_t nv = LimbActiveLength(v, n);
+    if (nu < nv || (nu == nv && LimbCompare(u, v, nu) < 0)) {
+        std::swap(u, v);
+        std::swap(nu, nv);
+    }
+
+    // u >= v, and v is zero from nv up to nu
+    while (nv > 1) {
+        const unsigned shift = std::countl_zero(u[nu - 1]);
+        int64_t matrix[4];
+        if (LimbLehmerMatrix(LimbLehmerWindow(u, nu, shift), LimbLehmerWindow(v, nu, shift), matrix) == 0) {
+            // The leading bits cannot settle even one quotient: take a full-precision step
+            LimbDivRem(t, w, u, nu, v, nv, divisionScratch);
+            std::swap(u, v);
+            std::swap(v, w);
+            nu = nv;
+        }
+        else {
+            LimbLehmerCombine(t, u, v, nu, matrix[0], matrix[1]);
+            LimbLehmerCombine(w, u, v, nu, matrix[2], matrix[3]);
+            std::swap(u, t);
+            std::swap(v, w);
+        }
+        nu = LimbActiveLength(u, nu);
+        nv = LimbActiveLength(v, nu);
+    }
+    if (nv == 1) {
+        u[0] = LimbGcdWord(v[0], LimbDivRem1(t, u, nu, v[0]));
+        nu = 1;
+    }
+    std::memmove(r, u, nu * sizeof(Limb));
+    std::memset(r + nu, 0, (n - nu) * sizeof(Limb));
+}
+
+inline void LimbGcd(Limb* r, Limb* a, Limb* b, size_t n, Limb* scratch) {
+    if (n >= LimbGcdLehmerThreshold) {
+        LimbGcdLehmer(r, a, b, n, scratch);
+    }
+    else {
+        LimbGcdBinary(r, a, b, n, scratch);
+    }
+}
+
+inline void LimbGcdExtended(Limb* g, Limb* x, Limb* y, const Limb* a, const Limb* b, size_t n, Limb* scratch) {
+    // Each remainder u of the sequence is kept with cofactor magnitudes su and tu, u = ±su a' ∓ tu b'
+    // for the ordered operands a' >= b'. Row i of the sequence has s of sign (-1)^i and t of sign
+    // (-1)^(i + 1), so one parity bit recovers both signs at the end.
+    Limb* u = scratch;
+    Limb* v = u + n;
+    Limb* t = v + n;
+    Limb* w = t + n;
+    Limb* su = w + n;
+    Limb* sv = su + n;
+    Limb* sNext = sv + n;
+    Limb* sAfter = sNext + n;
+    Limb* tu = sAfter + n;
+    Limb* tv = tu + n;
+    Limb* tNext = tv + n;
+    Limb* tAfter = tNext + n;
+    Limb* product = tAfter + n;
+    Limb* divisionScratch = product + 2 * n;
+
+    const bool swapped = LimbCompare(a, b, n) < 0;
+    std::memcpy(u, swapped ? b : a, n * sizeof(Limb));
+    std::memcpy(v, swapped ? a : b, n * sizeof(Limb));
+    std::fill(su, su + n, Limb{0});
+    std::fill(sv, sv + n, Limb{0});
+    std::fill(tu, tu + n, Limb{0});
+    std::fill(tv, tv + n, Limb{0});
+    if (n > 0) {
+        su[0] = 1;
+        tv[0] = 1;
+    }
+
+    size_t nu = LimbActiveLength(u, n);
+    size_t nv = LimbActiveLength(v, n);
+    bool oddRow = false;
+    while (nv > 0) {
+        const unsigned shift = std::countl_zero(u[nu - 1]);
+        int64_t matrix[4];
+        const size_t steps = LimbLehmerMatrix(LimbLehmerWindow(u, nu, shift), LimbLehmerWindow(v, nu, shift), matrix);
+        if (steps == 0) {
+            // One full-precision quotient q: the next cofactors are su + q sv and tu + q tv
+            LimbDivRem(t, w, u, nu, v, nv, divisionScratch);
+            const size_t nq = LimbActiveLength(t, nu - nv + 1);
+            LimbMulSchoolbook(product, t, nq, sv, n);
+            LimbAddN(sNext, su, product, n);
+            LimbMulSchoolbook(product, t, nq, tv, n);
+            LimbAddN(tNext, tu, product, n);
+
+            std::swap(u, v);
+            std::swap(v, w);
+            nu = nv;
+            std::swap(su, sv);
+            std::swap(sv, sNext);
+            std::swap(tu, tv);
+            std::swap(tv, tNext);
+            oddRow = !oddRow;
+        }
+        else {
+            LimbLehmerCombine(t, u, v, nu, matrix[0], matrix[1]);
+            LimbLehmerCombine(w, u, v, nu, matrix[2], matrix[3]);
+            std::swap(u, t);
+            std::swap(v, w);
+
+            LimbLehmerCombineMagnitudes(sNext, su, sv, n, matrix[0], matrix[1]);
+            LimbLehmerCombineMagnitudes(sAfter, su, sv, n, matrix[2], matrix[3]);
+            std::swap(su, sNext);
+            std::swap(sv, sAfter);
+            LimbLehmerCombineMagnitudes(tNext, tu, tv, n, matrix[0], matrix[1]);
+            LimbLehmerCombineMagnitudes(tAfter, tu, tv, n, matrix[2], matrix[3]);
+            std::swap(tu, tNext);
+            std::swap(tv, tAfter);
+            oddRow ^= (steps & 1) != 0;
+        }
+        nu = LimbActiveLength(u, nu);
+        nv = LimbActiveLength(v, nu);
+    }
+
+    std::memcpy(g, u, nu * sizeof(Limb));
+    std::memset(g + nu, 0, (n - nu) * sizeof(Limb));
+    if (oddRow) {
+        LimbNeg(su, su, n);
+    }
+    else {
+        LimbNeg(tu, tu, n);
+    }
+    std::memcpy(x, swapped ? tu : su, n * sizeof(Limb));
+    std::memcpy(y, swapped ? su : tu, n * sizeof(Limb));
+}
+
+#endif //LIMB_GCD_INL
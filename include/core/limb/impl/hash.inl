@@ -0,0 +1,184 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_HASH_INL
+#define LIMB_HASH_INL
+
+// Slice-by-8 tables for the reflected Castagnoli polynomial 0x82F63B78
+constexpr std::array<std::array<uint32_t, 256>, 8> LimbCrc32cTables = [] {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (size_t slice = 1; slice < 8; ++slice) {
+            const uint32_t previous = tables[slice - 1][i];
+            tables[slice][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
+        }
+    }
+    return tables;
+}();
+
+inline uint32_t LimbCrc32cSoftware(const uint8_t* data, size_t length, uint32_t crc) {
+    const auto& t = LimbCrc32cTables;
+    for (; length >= 8; data += 8, length -= 8) {
+        const Limb word = LimbLoad(data) ^ crc;
+        crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^ t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+              t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^ t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+    }
+    for (; length > 0; ++data, --length) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LIMB_HAS_CRC32C_INSTRUCTION 1
+__attribute__((target("sse4.2"))) inline uint32_t LimbCrc32cHardware(const uint8_t* data, size_t length, uint32_t crc) {
+    uint64_t state = crc;
+    for (; length >= 8; data += 8, length -= 8) {
+        state = _mm_crc32_u64(state, LimbLoad(data));
+    }
+    crc = static_cast<uint32_t>(state);
+    for (; length > 0; ++data, --length) {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+
+inline bool LimbCpuHasCrc32c() {
+#if defined(__SSE4_2__)
+    return true;
+#else
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+#endif
+}
+#else
+#define LIMB_HAS_CRC32C_INSTRUCTION 0
+#endif
+
+inline uint32_t LimbCrc32c(const uint8_t* data, size_t length, uint32_t crc) {
+    crc = ~crc;
+#if LIMB_HAS_CRC32C_INSTRUCTION
+    if (LimbCpuHasCrc32c()) {
+        return ~LimbCrc32cHardware(data, length, crc);
+    }
+#endif
+    return ~LimbCrc32cSoftware(data, length, crc);
+}
+
+// wyhash constants
+inline constexpr Limb LimbHashSecret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+inline Limb LimbHashMix(Limb a, Limb b) {
+    Limb high;
+    const Limb low = LimbMulWide(a, b, high);
+    return low ^ high;
+}
+
+inline uint64_t LimbHashFinish(Limb a, Limb b, Limb seed, size_t length) {
+    a ^= LimbHashSecret[1];
+    b ^= seed;
+    Limb high;
+    a = LimbMulWide(a, b, high);
+    return LimbHashMix(a ^ LimbHashSecret[0] ^ length, high ^ LimbHashSecret[1]);
+}
+
+inline uint64_t LimbHashBytes(const uint8_t* data, size_t length, uint64_t seed) {
+    auto read4 = [](const uint8_t* p) -> Limb {
+        return static_cast<Limb>(p[0]) | static_cast<Limb>(p[1]) << 8 | static_cast<Limb>(p[2]) << 16 | static_cast<Limb>(p[3]) << 24;
+    };
+
+    seed ^= LimbHashMix(seed ^ LimbHashSecret[0], LimbHashSecret[1]);
+    Limb a = 0;
+    Limb b = 0;
+    if (length <= 16) {
+        if (length >= 4) {
+            // Two overlapping 4-byte reads from each end cover 4..16 bytes
+            const size_t step = (length >> 3) << 2;
+            a = read4(data) << 32 | read4(data + step);
+            b = read4(data + length - 4) << 32 | read4(data + length - 4 - step);
+        }
+        else if (length > 0) {
+            a = static_cast<Limb>(data[0]) << 16 | static_cast<Limb>(data[length >> 1]) << 8 | data[length - 1];
+        }
+    }
+    else {
+        const uint8_t* p = data;
+        size_t remaining = length;
+        if (remaining > 48) {
+            // Three independent lanes of 16 bytes each
+            Limb lane1 = seed;
+            Limb lane2 = seed;
+            do {
+                seed = LimbHashMix(LimbLoad(p) ^ LimbHashSecret[1], LimbLoad(p + 8) ^ seed);
+                lane1 = LimbHashMix(LimbLoad(p + 16) ^ LimbHashSecret[2], LimbLoad(p + 24) ^ lane1);
+                lane2 = LimbHashMix(LimbLoad(p + 32) ^ LimbHashSecret[3], LimbLoad(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = LimbHashMix(LimbLoad(p) ^ LimbHashSecret[1], LimbLoad(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        // The last 16 bytes, overlapping what was already absorbed
+        a = LimbLoad(p + remaining - 16);
+        b = LimbLoad(p + remaining - 8);
+    }
+    return LimbHashFinish(a, b, seed, length);
+}
+
+template<typename LimbSource>
+uint64_t LimbHashLimbs(LimbSource&& limbAt, size_t n, uint64_t seed) {
+    // LimbHashBytes over the 8n little-endian bytes, with every word read through limbAt
+    const size_t length = n * LimbBytes;
+    seed ^= LimbHashMix(seed ^ LimbHashSecret[0], LimbHashSecret[1]);
+    Limb a = 0;
+    Limb b = 0;
+    if (n == 1) {
+        const Limb limb = limbAt(0);
+        a = limb << 32 | limb >> 32;
+        b = limb;
+    }
+    else if (n == 2) {
+        const Limb low = limbAt(0);
+        const Limb high = limbAt(1);
+        a = low << 32 | (high & 0xFFFFFFFFu);
+        b = (high >> 32) << 32 | low >> 32;
+    }
+    else if (n > 2) {
+        size_t i = 0;
+        size_t remaining = n;
+        if (remaining > 6) {
+            Limb lane1 = seed;
+            Limb lane2 = seed;
+            do {
+                seed = LimbHashMix(limbAt(i) ^ LimbHashSecret[1], limbAt(i + 1) ^ seed);
+                lane1 = LimbHashMix(limbAt(i + 2) ^ LimbHashSecret[2], limbAt(i + 3) ^ lane1);
+                lane2 = LimbHashMix(limbAt(i + 4) ^ LimbHashSecret[3], limbAt(i + 5) ^ lane2);
+                i += 6;
+                remaining -= 6;
+            } while (remaining > 6);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 2) {
+            seed = LimbHashMix(limbAt(i) ^ LimbHashSecret[1], limbAt(i + 1) ^ seed);
+            i += 2;
+            remaining -= 2;
+        }
+        a = limbAt(i + remaining - 2);
+        b = limbAt(i + remaining - 1);
+    }
+    return LimbHashFinish(a, b, seed, length);
+}
+
+#endif //LIMB_HASH_INL
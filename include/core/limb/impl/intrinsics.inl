@@ -0,0 +1,89 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_INTRINSICS_INL
+#define LIMB_INTRINSICS_INL
+
+#if defined(__has_builtin)
+#define LIMB_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define LIMB_HAS_BUILTIN(x) 0
+#endif
+
+inline Limb LimbAddCarry(Limb a, Limb b, bool& carry) {
+#if LIMB_HAS_BUILTIN(__builtin_addcll)
+    unsigned long long carryOut;
+    const Limb sum = __builtin_addcll(a, b, carry, &carryOut);
+    carry = carryOut != 0;
+    return sum;
+#elif defined(__x86_64__) || defined(_M_X64)
+    unsigned long long sum;
+    carry = _addcarry_u64(static_cast<unsigned char>(carry), a, b, &sum) != 0;
+    return sum;
+#else
+    const Limb partial = a + b;
+    const Limb sum = partial + carry;
+    carry = (partial < a) | (sum < partial);
+    return sum;
+#endif
+}
+
+inline Limb LimbSubBorrow(Limb a, Limb b, bool& borrow) {
+#if LIMB_HAS_BUILTIN(__builtin_subcll)
+    unsigned long long borrowOut;
+    const Limb diff = __builtin_subcll(a, b, borrow, &borrowOut);
+    borrow = borrowOut != 0;
+    return diff;
+#elif defined(__x86_64__) || defined(_M_X64)
+    unsigned long long diff;
+    borrow = _subborrow_u64(static_cast<unsigned char>(borrow), a, b, &diff) != 0;
+    return diff;
+#else
+    const Limb partial = a - b;
+    const Limb diff = partial - borrow;
+    borrow = (a < b) | (partial < static_cast<Limb>(borrow));
+    return diff;
+#endif
+}
+
+inline Limb LimbMulWide(Limb a, Limb b, Limb& high) {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    high = static_cast<Limb>(product >> 64);
+    return static_cast<Limb>(product);
+#elif defined(_M_X64)
+    unsigned long long productHigh;
+    const Limb low = _umul128(a, b, &productHigh);
+    high = productHigh;
+    return low;
+#else
+    // Split into 32-bit halves
+    const Limb aLow = a & 0xFFFFFFFFu, aHigh = a >> 32;
+    const Limb bLow = b & 0xFFFFFFFFu, bHigh = b >> 32;
+    const Limb lowLow = aLow * bLow;
+    const Limb lowHigh = aLow * bHigh;
+    const Limb highLow = aHigh * bLow;
+    const Limb middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFu) + (highLow & 0xFFFFFFFFu);
+    high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return (middle << 32) | (lowLow & 0xFFFFFFFFu);
+#endif
+}
+
+inline Limb LimbLoad(const uint8_t* bytes) {
+    Limb value;
+    std::memcpy(&value, bytes, sizeof(value));
+    if constexpr (std::endian::native == std::endian::big) {
+        value = __builtin_bswap64(value);
+    }
+    return value;
+}
+
+inline void LimbStore(uint8_t* bytes, Limb value) {
+    if constexpr (std::endian::native == std::endian::big) {
+        value = __builtin_bswap64(value);
+    }
+    std::memcpy(bytes, &value, sizeof(value));
+}
+
+#endif //LIMB_INTRINSICS_INL
@@ -0,0 +1,102 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_MONTGOMERY_INL
+#define LIMB_MONTGOMERY_INL
+
+constexpr Limb LimbMontgomeryInverse(Limb m) {
+    // m * m == 1 mod 8 for odd m, and every step doubles the number of correct bits: 3, 6, ..., 96
+    Limb inverse = m;
+    for (int i = 0; i < 5; ++i) {
+        inverse *= 2 - m * inverse;
+    }
+    return Limb{0} - inverse;
+}
+
+inline void LimbMontgomeryMul(Limb* r, const Limb* a, const Limb* b, const Limb* m, size_t n, Limb inverse, Limb* scratch) {
+    // t stays below 2m between rounds, so it needs one limb more than m
+    Limb* t = scratch;
+    std::fill(t, t + n + 1, Limb{0});
+
+    for (size_t i = 0; i < n; ++i) {
+        const Limb bi = b[i];
+
+        // Limb 0 of t + a * b[i] picks u, which makes limb 0 of t + a * b[i] + m * u vanish
+        Limb productCarry;
+        Limb low = LimbMulWide(a[0], bi, productCarry);
+        low += t[0];
+        productCarry += low < t[0];
+        const Limb u = low * inverse;
+        Limb reduceCarry;
+        const Limb reduced = LimbMulWide(m[0], u, reduceCarry);
+        reduceCarry += reduced + low < reduced;
+
+        // One pass adds both products and shifts t down a limb
+        for (size_t j = 1; j < n; ++j) {
+            Limb high;
+            low = LimbMulWide(a[j], bi, high);
+            low += t[j];
+            high += low < t[j];
+            low += productCarry;
+            high += low < productCarry;
+            productCarry = high;
+
+            Limb reducedLow = LimbMulWide(m[j], u, high);
+            reducedLow += low;
+            high += reducedLow < low;
+            reducedLow += reduceCarry;
+            high += reducedLow < reduceCarry;
+            reduceCarry = high;
+            t[j - 1] = reducedLow;
+        }
+        bool overflow = false;
+        const Limb top = LimbAddCarry(t[n], productCarry, overflow);
+        Limb topCarry = overflow;
+        overflow = false;
+        t[n - 1] = LimbAddCarry(top, reduceCarry, overflow);
+        t[n] = topCarry + overflow;
+    }
+
+    // t - m when that does not borrow past t[n], else t; both are computed either way
+    Limb* difference = t + n + 1;
+    const bool borrow = LimbSubN(difference, t, m, n);
+    LimbCtSelect(r, t, difference, n, LimbCtMask(Limb{borrow} & (t[n] ^ 1)));
+}
+
+inline void LimbMontgomerySqr(Limb* r, const Limb* a, const Limb* m, size_t n, Limb inverse, Limb* scratch) {
+    Limb* t = scratch;
+    std::fill(t, t + 2 * n + 1, Limb{0});
+
+    // Cross products a[i] * a[j] for i < j, doubled, plus the squares on the diagonal
+    for (size_t i = 0; i + 1 < n; ++i) {
+        t[i + n] = LimbAddMul1(t + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+    }
+    LimbShiftLeft(t, t, 2 * n, 1);
+    bool carry = false;
+    for (size_t i = 0; i < n; ++i) {
+        Limb high;
+        const Limb low = LimbMulWide(a[i], a[i], high);
+        t[2 * i] = LimbAddCarry(t[2 * i], low, carry);
+        t[2 * i + 1] = LimbAddCarry(t[2 * i + 1], high, carry);
+    }
+
+    // Clear one low limb per round; the bit carried past t[i + n] joins the next round
+    Limb pending = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const Limb high = LimbAddMul1(t + i, m, n, t[i] * inverse);
+        bool overflow = false;
+        Limb top = LimbAddCarry(t[i + n], high, overflow);
+        Limb nextPending = overflow;
+        overflow = false;
+        t[i + n] = LimbAddCarry(top, pending, overflow);
+        pending = nextPending + overflow;
+    }
+
+    // Same masked final subtraction as LimbMontgomeryMul; the low half of t is free again
+    Limb* result = t + n;
+    const bool borrow = LimbSubN(t, result, m, n);
+    LimbCtSelect(r, result, t, n, LimbCtMask(Limb{borrow} & (pending ^ 1)));
+}
+
+#endif //LIMB_MONTGOMERY_INL
@@ -0,0 +1,278 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_MULTIPLICATION_INL
+#define LIMB_MULTIPLICATION_INL
+
+constexpr size_t LimbMulScratchSize(size_t n) {
+    if (n < LimbKaratsubaThreshold) {
+        return 0;
+    }
+    if (n < LimbToom3Threshold) {
+        // |a0 - a1|, |b0 - b1|, their product and z1, then the recursive products
+        const size_t low = n / 2;
+        const size_t high = n - low;
+        return 6 * high + 1 + std::max(LimbMulScratchSize(low), LimbMulScratchSize(high));
+    }
+    // Four evaluation buffers, three interpolation buffers, then the recursive products
+    const size_t k = (n + 2) / 3;
+    const size_t s = n - 2 * k;
+    return 4 * (k + 1) + 3 * (2 * k + 2) +
+           std::max({ LimbMulScratchSize(k + 1), LimbMulScratchSize(k), LimbMulScratchSize(s) });
+}
+
+inline Limb LimbMul1(Limb* r, const Limb* a, size_t n, Limb b) {
+    Limb carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Limb high;
+        Limb low = LimbMulWide(a[i], b, high);
+        low += carry;
+        high += low < carry;
+        r[i] = low;
+        carry = high;
+    }
+    return carry;
+}
+
+inline Limb LimbAddMul1(Limb* r, const Limb* a, size_t n, Limb b) {
+    Limb carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        Limb high;
+        Limb low = LimbMulWide(a[i], b, high);
+        low += carry;
+        high += low < carry;
+        const Limb current = r[i];
+        low += current;
+        high += low < current;
+        r[i] = low;
+        carry = high;
+    }
+    return carry;
+}
+
+inline void LimbMulSchoolbook(Limb* r, const Limb* a, size_t na, const Limb* b, size_t nb) {
+    r[na] = LimbMul1(r, a, na, b[0]);
+    for (size_t j = 1; j < nb; ++j) {
+        r[na + j] = LimbAddMul1(r + j, a, na, b[j]);
+    }
+}
+
+inline void LimbMulLow(Limb* r, const Limb* a, const Limb* b, size_t n) {
+    // Row j only contributes to limbs j..n-1
+    LimbMul1(r, a, n, b[0]);
+    for (size_t j = 1; j < n; ++j) {
+        LimbAddMul1(r + j, a, n - j, b[j]);
+    }
+}
+
+inline void LimbMul(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch) {
+    if (n < LimbKaratsubaThreshold) {
+        LimbMulSchoolbook(r, a, n, b, n);
+    }
+    else if (n < LimbToom3Threshold) {
+        LimbMulKaratsuba(r, a, b, n, scratch);
+    }
+    else {
+        LimbMulToom3(r, a, b, n, scratch);
+    }
+}
+
+inline void LimbMulKaratsuba(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch) {
+    // a = a1 * B^m + a0, b = b1 * B^m + b0 with B = 2^64
+    // a * b = z2 * B^2m + z1 * B^m + z0, z1 = z0 + z2 - (a0 - a1)(b0 - b1)
+    const size_t m = n / 2;
+    const size_t h = n - m;
+    const Limb* a0 = a;
+    const Limb* a1 = a + m;
+    const Limb* b0 = b;
+    const Limb* b1 = b + m;
+
+    Limb* da = scratch;
+    Limb* db = da + h;
+    Limb* t = db + h;
+    Limb* z1 = t + 2 * h;
+    Limb* next = z1 + 2 * h + 1;
+
+    const bool aNegative = LimbAbsDiff(da, a0, m, a1, h);
+    const bool bNegative = LimbAbsDiff(db, b0, m, b1, h);
+
+    LimbMul(r, a0, b0, m, next);
+    LimbMul(r + 2 * m, a1, b1, h, next);
+    LimbMul(t, da, db, h, next);
+
+    // z1 = z0 + z2 -/+ t
+    std::memcpy(z1, r + 2 * m, 2 * h * sizeof(Limb));
+    z1[2 * h] = 0;
+    bool carry = LimbAddN(z1, z1, r, 2 * m);
+    LimbAdd1(z1 + 2 * m, z1 + 2 * m, 2 * h + 1 - 2 * m, carry);
+    if (aNegative == bNegative) {
+        const bool borrow = LimbSubN(z1, z1, t, 2 * h);
+        z1[2 * h] -= borrow;
+    }
+    else {
+        carry = LimbAddN(z1, z1, t, 2 * h);
+        z1[2 * h] += carry;
+    }
+
+    carry = LimbAddN(r + m, r + m, z1, 2 * h + 1);
+    LimbAdd1(r + m + 2 * h + 1, r + m + 2 * h + 1, 2 * n - (m + 2 * h + 1), carry);
+}
+
+inline void LimbMulToom3(Limb* r, const Limb* a, const Limb* b, size_t n, Limb* scratch) {
+    // Split into three k-limb pieces (the top one has s limbs), evaluate at 0, 1, -1, -2 and
+    // infinity, multiply pointwise and interpolate with Bodrato's sequence. The interpolation
+    // buffers are w limbs wide and hold signed values in two's complement.
+    const size_t k = (n + 2) / 3;
+    const size_t s = n - 2 * k;
+    const size_t w = 2 * k + 2;
+    const Limb* a0 = a;
+    const Limb* a1 = a + k;
+    const Limb* a2 = a + 2 * k;
+    const Limb* b0 = b;
+    const Limb* b1 = b + k;
+    const Limb* b2 = b + 2 * k;
+
+    Limb* ea = scratch;
+    Limb* eb = ea + (k + 1);
+    Limb* pa = eb + (k + 1);
+    Limb* pb = pa + (k + 1);
+    Limb* v1 = pb + (k + 1);
+    Limb* vm1 = v1 + w;
+    Limb* vm2 = vm1 + w;
+    Limb* next = vm2 + w;
+
+    // ===== EVALUATION =====
+    auto addWide = [](Limb* dst, const Limb* x, size_t nx, const Limb* y, size_t ny) {
+        // dst (nx + 1 limbs) = x (nx limbs) + y (ny <= nx limbs)
+        const bool carry = LimbAddN(dst, x, y, ny);
+        dst[nx] = LimbAdd1(dst + ny, x + ny, nx - ny, carry);
+    };
+
+    // p(1) = a0 + a1 + a2
+    addWide(ea, a0, k, a2, s);
+    addWide(eb, b0, k, b2, s);
+    // The sums stay below 3 * B^k, so k + 1 limbs are enough
+    pa[k] = ea[k] + LimbAddN(pa, ea, a1, k);
+    pb[k] = eb[k] + LimbAddN(pb, eb, b1, k);
+    LimbMul(v1, pa, pb, k + 1, next);
+
+    // p(-1) = a0 - a1 + a2
+    bool aNegative = !LimbAbsDiff(pa, a1, k, ea, k + 1);
+    bool bNegative = !LimbAbsDiff(pb, b1, k, eb, k + 1);
+    LimbMul(vm1, pa, pb, k + 1, next);
+    if (aNegative != bNegative) {
+        LimbNeg(vm1, vm1, w);
+    }
+
+    // p(-2) = a0 - 2 * a1 + 4 * a2
+    auto evaluateMinusTwo = [&](Limb* even, Limb* odd, const Limb* x0, const Limb* x1, const Limb* x2) {
+        odd[s] = LimbShiftLeft(odd, x2, s, 2);
+        for (size_t i = s + 1; i <= k; ++i) {
+            odd[i] = 0;
+        }
+        const bool carry = LimbAddN(even, x0, odd, k);
+        even[k] = odd[k] + carry;
+        odd[k] = LimbShiftLeft(odd, x1, k, 1);
+        return !LimbAbsDiff(odd, odd, k + 1, even, k + 1);
+    };
+    aNegative = evaluateMinusTwo(ea, pa, a0, a1, a2);
+    bNegative = evaluateMinusTwo(eb, pb, b0, b1, b2);
+    LimbMul(vm2, pa, pb, k + 1, next);
+    if (aNegative != bNegative) {
+        LimbNeg(vm2, vm2, w);
+    }
+
+    // p(0) and p(inf) go straight to their final place
+    LimbMul(r, a0, b0, k, next);
+    LimbMul(r + 4 * k, a2, b2, s, next);
+    std::memset(r + 2 * k, 0, 2 * k * sizeof(Limb));
+    const Limb* v0 = r;
+    const Limb* vinf = r + 4 * k;
+
+    // ===== INTERPOLATION =====
+    auto addNarrow = [w](Limb* dst, const Limb* x, size_t nx) {
+        const bool carry = LimbAddN(dst, dst, x, nx);
+        LimbAdd1(dst + nx, dst + nx, w - nx, carry);
+    };
+    auto subNarrow = [w](Limb* dst, const Limb* x, size_t nx) {
+        const bool borrow = LimbSubN(dst, dst, x, nx);
+        LimbSub1(dst + nx, dst + nx, w - nx, borrow);
+    };
+    auto halve = [w](Limb* dst) {
+        const Limb sign = dst[w - 1] & (Limb{1} << (LimbBits - 1));
+        LimbShiftRight(dst, dst, w, 1);
+        dst[w - 1] |= sign;
+    };
+
+    LimbSubN(vm2, vm2, v1, w); // r3 = (v(-2) - v(1)) / 3
+    LimbDivExact3(vm2, vm2, w);
+    LimbSubN(v1, v1, vm1, w); // r1 = (v(1) - v(-1)) / 2
+    halve(v1);
+    subNarrow(vm1, v0, 2 * k); // r2 = v(-1) - v(0)
+    LimbSubN(vm2, vm1, vm2, w); // r3 = (r2 - r3) / 2 + 2 * v(inf)
+    halve(vm2);
+    addNarrow(vm2, vinf, 2 * s);
+    addNarrow(vm2, vinf, 2 * s);
+    LimbAddN(vm1, vm1, v1, w); // r2 = r2 + r1 - v(inf)
+    subNarrow(vm1, vinf, 2 * s);
+    LimbSubN(v1, v1, vm2, w); // r1 = r1 - r3
+
+    // ===== RECOMPOSITION =====
+    auto addAt = [r, n](size_t offset, const Limb* x, size_t nx) {
+        // The coefficients are exact, so anything past 2n limbs is zero
+        const size_t length = std::min(nx, 2 * n - offset);
+        const bool carry = LimbAddN(r + offset, r + offset, x, length);
+        LimbAdd1(r + offset + length, r + offset + length, 2 * n - offset - length, carry);
+    };
+    addAt(k, v1, w);
+    addAt(2 * k, vm1, w);
+    addAt(3 * k, vm2, w);
+}
+
+template<size_t n>
+void LimbMulFixed(Limb* r, const Limb* a, const Limb* b) {
+    if constexpr (n < LimbKaratsubaThreshold) {
+        LimbMulSchoolbook(r, a, n, b, n);
+    }
+    else {
+        std::array<Limb, LimbMulScratchSize(n)> scratch;
+        if constexpr (n < LimbToom3Threshold) {
+            LimbMulKaratsuba(r, a, b, n, scratch.data());
+        }
+        else {
+            LimbMulToom3(r, a, b, n, scratch.data());
+        }
+    }
+}
+
+template<size_t n>
+void LimbMulLowFixed(Limb* r, const Limb* a, const Limb* b) {
+    if constexpr (n < LimbKaratsubaThreshold) {
+        LimbMulLow(r, a, b, n);
+    }
+    else {
+        // The subquadratic tiers only produce full products
+        std::array<Limb, 2 * n> product;
+        LimbMulFixed<n>(product.data(), a, b);
+        std::memcpy(r, product.data(), n * sizeof(Limb));
+    }
+}
+
+inline void LimbDivExact3(Limb* r, const Limb* a, size_t n) {
+    // Hensel division: multiply each limb by 3^-1 mod 2^64 and carry the high part of q * 3
+    constexpr Limb inverseOfThree = 0xAAAAAAAAAAAAAAABull;
+    Limb carry = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const Limb current = a[i];
+        const Limb difference = current - carry;
+        const Limb borrow = current < carry;
+        const Limb quotient = difference * inverseOfThree;
+        r[i] = quotient;
+        Limb high;
+        LimbMulWide(quotient, 3, high);
+        carry = high + borrow;
+    }
+}
+
+#endif //LIMB_MULTIPLICATION_INL
@@ -0,0 +1,276 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_RADIX_INL
+#define LIMB_RADIX_INL
+
+constexpr LimbRadix LimbRadixFor(unsigned base) {
+    Limb power = base;
+    size_t digits = 1;
+    while (power <= ~Limb{0} / base) {
+        power *= base;
+        ++digits;
+    }
+    return { power, digits };
+}
+
+constexpr uint8_t LimbDigitValue(char c) {
+    if ('0' <= c && c <= '9') {
+        return static_cast<uint8_t>(c - '0');
+    }
+    if ('a' <= c && c <= 'z') {
+        return static_cast<uint8_t>(c - 'a' + 10);
+    }
+    if ('A' <= c && c <= 'Z') {
+        return static_cast<uint8_t>(c - 'A' + 10);
+    }
+    return 255;
+}
+
+/**
+ * @brief Writes exactly width digits of a (n limbs, consumed) ending at out + width, zero-padded.
+ */
+inline void LimbToDigitsBasecase(char* out, size_t width, Limb* a, size_t n, unsigned base) {
+    constexpr char digitChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    const LimbRadix radix = LimbRadixFor(base);
+    char* cursor = out + width;
+
+    while (n > 0 && a[n - 1] == 0) {
+        --n;
+    }
+    while (n > 0) {
+        // One single-limb division peels off radix.digits digits
+        Limb chunk = LimbDivRem1(a, a, n, radix.power);
+        while (n > 0 && a[n - 1] == 0) {
+            --n;
+        }
+        const size_t count = n > 0 ? radix.digits : 0;
+        size_t written = 0;
+        if (base == 10) {
+            for (; written < count || (count == 0 && chunk != 0); ++written) {
+                *--cursor = digitChars[chunk % 10];
+                chunk /= 10;
+            }
+        }
+        else {
+            for (; written < count || (count == 0 && chunk != 0); ++written) {
+                *--cursor = digitChars[chunk % base];
+                chunk /= base;
+            }
+        }
+    }
+    std::fill(out, cursor, '0');
+}
+
+/**
+ * @brief r = a * b for unbalanced operands; r has na + nb limbs.
+ * Allocates padded copies and scratch once the shorter operand reaches the Karatsuba threshold.
+ */
+inline void LimbMulUnbalanced(Limb* r, const Limb* a, size_t na, const Limb* b, size_t nb) {
+    const size_t n = std::max(na, nb);
+    if (std::min(na, nb) < LimbKaratsubaThreshold) {
+        LimbMulSchoolbook(r, a, na, b, nb);
+        return;
+    }
+    std::vector<Limb> paddedA(n, 0);
+    std::vector<Limb> paddedB(n, 0);
+    std::vector<Limb> product(2 * n);
+    std::vector<Limb> scratch(LimbMulScratchSize(n));
+    std::copy_n(a, na, paddedA.begin());
+    std::copy_n(b, nb, paddedB.begin());
+    LimbMul(product.data(), paddedA.data(), paddedB.data(), n, scratch.data());
+    std::copy_n(product.begin(), na + nb, r);
+}
+
+/**
+ * @brief base^(k * 2^i) for i = 0, 1, ... where k = LimbRadixFor(base).digits, each with its digit count.
+ * Powers are built by repeated squaring until the next one would exceed maxLimbs limbs,
+ * and truncated to truncateLimbs limbs when that is non-zero.
+ */
+struct LimbRadixPowers {
+    std::vector<std::vector<Limb> > powers;
+    std::vector<size_t> digits;
+
+    LimbRadixPowers(unsigned base, size_t maxLimbs, size_t maxDigits, size_t truncateLimbs) {
+        const LimbRadix radix = LimbRadixFor(base);
+        powers.push_back({ radix.power });
+        digits.push_back(radix.digits);
+        while (true) {
+            const std::vector<Limb>& last = powers.back();
+            const size_t n = last.size();
+            if (2 * n > maxLimbs || 2 * digits.back() > maxDigits) {
+                break;
+            }
+            std::vector<Limb> square(2 * n);
+            std::vector<Limb> scratch(LimbMulScratchSize(n));
+            LimbMul(square.data(), last.data(), last.data(), n, scratch.data());
+            while (square.size() > 1 && square.back() == 0) {
+                square.pop_back();
+            }
+            if (truncateLimbs != 0 && square.size() > truncateLimbs) {
+                square.resize(truncateLimbs);
+            }
+            digits.push_back(2 * digits.back());
+            powers.push_back(std::move(square));
+        }
+    }
+};
+
+/**
+ * @brief Divide-and-conquer formatting: splits a by a cached power of the base and formats both halves.
+ * Allocates the quotient, remainder and division scratch at each level.
+ */
+inline void LimbToDigitsRecursive(char* out, size_t width, Limb* a, size_t n, const LimbRadixPowers& table, unsigned base) {
+    while (n > 0 && a[n - 1] == 0) {
+        --n;
+    }
+    size_t level = table.powers.size();
+    while (level > 0 && 2 * table.powers[level - 1].size() > n + 1) {
+        --level;
+    }
+    if (n < LimbRadixThreshold || level == 0) {
+        LimbToDigitsBasecase(out, width, a, n, base);
+        return;
+    }
+
+    // a = q * base^d + r with r < base^d: q gives the leading width - d digits, r the trailing d
+    const std::vector<Limb>& power = table.powers[level - 1];
+    const size_t d = table.digits[level - 1];
+    std::vector<Limb> quotient(n);
+    std::vector<Limb> remainder(power.size());
+    std::vector<Limb> scratch(LimbDivRemScratchSize(n, power.size()));
+    LimbDivRem(quotient.data(), remainder.data(), a, n, power.data(), power.size(), scratch.data());
+
+    LimbToDigitsRecursive(out, width - d, quotient.data(), quotient.size(), table, base);
+    LimbToDigitsRecursive(out + width - d, d, remainder.data(), remainder.size(), table, base);
+}
+
+inline std::string LimbToString(const Limb* a, size_t n, unsigned base) {
+    while (n > 0 && a[n - 1] == 0) {
+        --n;
+    }
+    if (n == 0) {
+        return "0";
+    }
+
+    if (const unsigned bitsPerDigit = LimbPow2DigitBits(base); bitsPerDigit != 0) {
+        std::string result((n * LimbBits + bitsPerDigit - 1) / bitsPerDigit, '0');
+        LimbToDigitsPow2(result.data(), result.size(), a, n, bitsPerDigit);
+        result.erase(0, result.find_first_not_of('0'));
+        return result;
+    }
+
+    // base^(digits + 1) exceeds 2^64, so n limbs never need more than n * (digits + 1) digits
+    const LimbRadix radix = LimbRadixFor(base);
+    std::string result(n * (radix.digits + 1), '0');
+    std::vector<Limb> work(a, a + n);
+    if (n < LimbRadixThreshold) {
+        LimbToDigitsBasecase(result.data(), result.size(), work.data(), n, base);
+    }
+    else {
+        const LimbRadixPowers table(base, n + 1, result.size(), 0);
+        LimbToDigitsRecursive(result.data(), result.size(), work.data(), n, table, base);
+    }
+    result.erase(0, result.find_first_not_of('0'));
+    return result;
+}
+
+/**
+ * @brief Parses already validated digits into r (n limbs) chunk by chunk, modulo 2^(64n).
+ */
+inline void LimbFromDigitsBasecase(Limb* r, size_t n, std::string_view digits, unsigned base) {
+    const LimbRadix radix = LimbRadixFor(base);
+    std::fill_n(r, n, Limb{0});
+    if (n == 0) {
+        return;
+    }
+
+    size_t used = 0;
+    size_t position = 0;
+    size_t chunkLength = digits.size() % radix.digits;
+    if (chunkLength == 0) {
+        chunkLength = radix.digits;
+    }
+    while (position < digits.size()) {
+        Limb chunk = 0;
+        for (size_t i = 0; i < chunkLength; ++i) {
+            chunk = chunk * base + LimbDigitValue(digits[position + i]);
+        }
+        position += chunkLength;
+
+        // r = r * base^chunkLength + chunk; only the first chunk can be short, and r is still zero then
+        if (used == 0) {
+            r[0] = chunk;
+            used = chunk != 0;
+        }
+        else {
+            const Limb high = LimbMul1(r, r, used, radix.power);
+            const Limb carry = LimbAdd1(r, r, used, chunk);
+            if (used < n && (high | carry) != 0) {
+                r[used++] = high + carry;
+            }
+        }
+        chunkLength = radix.digits;
+    }
+}
+
+/**
+ * @brief Divide-and-conquer parsing: value = high * base^d + low, kept modulo 2^(64 * limbs).
+ * Allocates the partial results and product scratch at each level.
+ */
+inline std::vector<Limb> LimbFromDigitsRecursive(std::string_view digits, size_t limbs, const LimbRadixPowers& table, unsigned base) {
+    const size_t estimate = std::min(limbs, digits.size() / table.digits[0] + 1);
+    size_t level = table.digits.size();
+    while (level > 0 && 2 * table.digits[level - 1] > digits.size()) {
+        --level;
+    }
+    if (estimate < LimbRadixParseThreshold || level == 0) {
+        std::vector<Limb> result(estimate);
+        LimbFromDigitsBasecase(result.data(), result.size(), digits, base);
+        return result;
+    }
+
+    const std::vector<Limb>& power = table.powers[level - 1];
+    const size_t d = table.digits[level - 1];
+    const std::vector<Limb> high = LimbFromDigitsRecursive(digits.substr(0, digits.size() - d), limbs, table, base);
+    const std::vector<Limb> low = LimbFromDigitsRecursive(digits.substr(digits.size() - d), limbs, table, base);
+
+    std::vector<Limb> result(high.size() + power.size() + 1, 0);
+    LimbMulUnbalanced(result.data(), high.data(), high.size(), power.data(), power.size());
+    const bool carry = LimbAddN(result.data(), result.data(), low.data(), low.size());
+    LimbAdd1(result.data() + low.size(), result.data() + low.size(), result.size() - low.size(), carry);
+    while (result.size() > 1 && result.back() == 0) {
+        result.pop_back();
+    }
+    if (result.size() > limbs) {
+        result.resize(limbs);
+    }
+    return result;
+}
+
+inline bool LimbFromString(Limb* r, size_t n, std::string_view digits, unsigned base) {
+    if (const unsigned bitsPerDigit = LimbPow2DigitBits(base); bitsPerDigit != 0) {
+        return LimbFromDigitsPow2(r, n, digits, bitsPerDigit);
+    }
+
+    for (const char c : digits) {
+        if (LimbDigitValue(c) >= base) {
+            return false;
+        }
+    }
+
+    const LimbRadix radix = LimbRadixFor(base);
+    if (digits.size() / radix.digits < LimbRadixParseThreshold || n < LimbRadixParseThreshold) {
+        LimbFromDigitsBasecase(r, n, digits, base);
+        return true;
+    }
+
+    const LimbRadixPowers table(base, n, digits.size() / 2, n);
+    const std::vector<Limb> value = LimbFromDigitsRecursive(digits, n, table, base);
+    std::fill_n(r, n, Limb{0});
+    std::copy_n(value.begin(), std::min(n, value.size()), r);
+    return true;
+}
+
+#endif //LIMB_RADIX_INL
@@ -0,0 +1,152 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_RADIX_POW2_INL
+#define LIMB_RADIX_POW2_INL
+
+constexpr unsigned LimbPow2DigitBits(unsigned base) {
+    switch (base) {
+        case 2: return 1;
+        case 4: return 2;
+        case 8: return 3;
+        case 16: return 4;
+        case 32: return 5;
+        default: return 0;
+    }
+}
+
+inline void LimbHexEncode(char* out, const Limb* a, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const Limb limb = a[n - 1 - i];
+        char* chunk = out + 16 * i;
+#if defined(__SSE2__) || defined(_M_X64)
+        // Most significant byte first, then split every byte into its high and low nibble
+        const __m128i bytes = _mm_cvtsi64_si128(static_cast<long long>(__builtin_bswap64(limb)));
+        const __m128i low = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+        const __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+        const __m128i nibbles = _mm_unpacklo_epi8(high, low);
+        // '0' + v, plus 7 more for 'A'..'F'
+        const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8(7));
+        const __m128i chars = _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(chunk), chars);
+#else
+        constexpr char digitChars[] = "0123456789ABCDEF";
+        for (size_t j = 0; j < 16; ++j) {
+            chunk[j] = digitChars[(limb >> (60 - 4 * j)) & 0xF];
+        }
+#endif
+    }
+}
+
+inline bool LimbHexDecode(Limb* r, const char* in, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const char* chunk = in + 16 * i;
+#if defined(__SSE2__) || defined(_M_X64)
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chunk));
+        // Signed compares: bytes >= 0x80 are negative and fail both ranges
+        const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+        const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+        const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+        const __m128i letters = _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10));
+        const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+        if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) {
+            return false;
+        }
+        const __m128i nibbles = _mm_or_si128(_mm_and_si128(isDigit, digits), _mm_and_si128(isLetter, letters));
+        // Each 16-bit lane holds (first, second) nibble; fold into first << 4 | second
+        const __m128i pairs = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00F0)), _mm_srli_epi16(nibbles, 8));
+        const __m128i bytes = _mm_packus_epi16(pairs, pairs);
+        r[n - 1 - i] = __builtin_bswap64(static_cast<Limb>(_mm_cvtsi128_si64(bytes)));
+#else
+        Limb limb = 0;
+        for (size_t j = 0; j < 16; ++j) {
+            const uint8_t value = LimbDigitValue(chunk[j]);
+            if (value >= 16) {
+                return false;
+            }
+            limb = (limb << 4) | value;
+        }
+        r[n - 1 - i] = limb;
+#endif
+    }
+    return true;
+}
+
+inline void LimbToDigitsPow2(char* out, size_t width, const Limb* a, size_t n, unsigned bitsPerDigit) {
+    constexpr char digitChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    const size_t available = (n * LimbBits + bitsPerDigit - 1) / bitsPerDigit;
+    const size_t count = std::min(width, available);
+    std::fill(out, out + (width - count), '0');
+
+    if (bitsPerDigit == 4) {
+        // Whole limbs through the vector kernel, then keep the trailing count digits
+        std::string buffer(16 * n, '0');
+        LimbHexEncode(buffer.data(), a, n);
+        std::copy_n(buffer.end() - count, count, out + (width - count));
+        return;
+    }
+
+    const Limb mask = LimbMask(bitsPerDigit);
+    char* cursor = out + width;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t bit = i * bitsPerDigit;
+        const size_t index = bit / LimbBits;
+        const size_t shift = bit % LimbBits;
+        Limb value = a[index] >> shift;
+        if (shift + bitsPerDigit > LimbBits && index + 1 < n) {
+            value |= a[index + 1] << (LimbBits - shift);
+        }
+        *--cursor = digitChars[value & mask];
+    }
+}
+
+inline bool LimbFromDigitsPow2(Limb* r, size_t n, std::string_view digits, unsigned bitsPerDigit) {
+    std::fill_n(r, n, Limb{0});
+    size_t remaining = digits.size();
+
+    if (bitsPerDigit == 4) {
+        // Whole limbs from the least significant end through the vector kernel
+        const size_t wholeLimbs = std::min(n, remaining / 16);
+        if (!LimbHexDecode(r, digits.data() + (remaining - 16 * wholeLimbs), wholeLimbs)) {
+            return false;
+        }
+        remaining -= 16 * wholeLimbs;
+        if (wholeLimbs == n) {
+            // Everything left lies above 64n bits; it only needs validating
+            return std::all_of(digits.begin(), digits.begin() + remaining, [](char c) { return LimbDigitValue(c) < 16; });
+        }
+        Limb limb = 0;
+        for (size_t i = 0; i < remaining; ++i) {
+            const uint8_t value = LimbDigitValue(digits[i]);
+            if (value >= 16) {
+                return false;
+            }
+            limb = (limb << 4) | value;
+        }
+        r[wholeLimbs] = limb;
+        return true;
+    }
+
+    const unsigned base = 1u << bitsPerDigit;
+    const size_t totalBits = n * LimbBits;
+    for (size_t i = 0; i < remaining; ++i) {
+        const uint8_t value = LimbDigitValue(digits[remaining - 1 - i]);
+        if (value >= base) {
+            return false;
+        }
+        const size_t bit = i * bitsPerDigit;
+        if (bit >= totalBits || value == 0) {
+            continue;
+        }
+        const size_t index = bit / LimbBits;
+        const size_t shift = bit % LimbBits;
+        r[index] |= static_cast<Limb>(value) << shift;
+        if (shift + bitsPerDigit > LimbBits && index + 1 < n) {
+            r[index + 1] |= static_cast<Limb>(value) >> (LimbBits - shift);
+        }
+    }
+    return true;
+}
+
+#endif //LIMB_RADIX_POW2_INL
@@ -0,0 +1,79 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef LIMB_SHIFT_INL
+#define LIMB_SHIFT_INL
+
+inline Limb LimbShiftLeft(Limb* r, const Limb* a, size_t n, unsigned shift) {
+    // High to low so r may alias a
+    if (n == 0) {
+        return 0;
+    }
+    const Limb out = a[n - 1] >> (LimbBits - shift);
+    for (size_t i = n - 1; i > 0; --i) {
+        r[i] = (a[i] << shift) | (a[i - 1] >> (LimbBits - shift));
+    }
+    r[0] = a[0] << shift;
+    return out;
+}
+
+inline Limb LimbShiftRight(Limb* r, const Limb* a, size_t n, unsigned shift) {
+    // Low to high so r may alias a
+    if (n == 0) {
+        return 0;
+    }
+    const Limb out = a[0] << (LimbBits - shift);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        r[i] = (a[i] >> shift) | (a[i + 1] << (LimbBits - shift));
+    }
+    r[n - 1] = a[n - 1] >> shift;
+    return out;
+}
+
+inline void LimbShiftRightBits(Limb* a, size_t n, size_t shift) {
+    const size_t limbShift = std::min(shift / LimbBits, n);
+    const unsigned bitShift = shift % LimbBits;
+    if (limbShift > 0) {
+        std::memmove(a, a + limbShift, (n - limbShift) * sizeof(Limb));
+        std::memset(a + n - limbShift, 0, limbShift * sizeof(Limb));
+    }
+    if (bitShift > 0 && limbShift < n) {
+        LimbShiftRight(a, a, n - limbShift, bitShift);
+    }
+}
+
+inline void LimbShiftLeftBits(Limb* r, size_t n, const Limb* a, size_t na, size_t shift) {
+    const size_t limbShift = shift / LimbBits;
+    const unsigned bitShift = shift % LimbBits;
+    std::memmove(r + limbShift, a, na * sizeof(Limb));
+    std::memset(r, 0, limbShift * sizeof(Limb));
+    std::memset(r + limbShift + na, 0, (n - limbShift - na) * sizeof(Limb));
+    if (bitShift > 0) {
+        const Limb out = LimbShiftLeft(r + limbShift, r + limbShift, na, bitShift);
+        if (limbShift + na < n) {
+            r[limbShift + na] = out;
+        }
+    }
+}
+
+inline size_t LimbCountLeadingZeros(const Limb* a, size_t n) {
+    for (size_t i = n; i > 0; --i) {
+        if (a[i - 1] != 0) {
+            return (n - i) * LimbBits + std::countl_zero(a[i - 1]);
+        }
+    }
+    return n * LimbBits;
+}
+
+inline bool LimbTestLowBits(const Limb* a, size_t n, size_t count) {
+    const size_t fullLimbs = std::min(count / LimbBits, n);
+    for (size_t i = 0; i < fullLimbs; ++i) {
+        if (a[i] != 0) {
+            return true;
+        }
+    }
+    return fullLimbs < n && (a[fullLimbs] & LimbMask(count % LimbBits)) != 0;
+}
+
+#endif //LIMB_SHIFT_INL
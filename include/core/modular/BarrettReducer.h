@@ -0,0 +1,69 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef BARRETTREDUCER_H
+#define BARRETTREDUCER_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+#include <core/limb/LimbEngine.h>
+#include <core/unsigned-int/ArbitraryUnsignedInt.h>
+
+/**
+ * @brief Repeated x mod M for one fixed modulus by Barrett reduction.
+ *
+ * With k the number of significant limbs of M, the reducer keeps mu = floor(2^(128k) / M). A value
+ * of up to 2k limbs then reduces with two multiplications and at most two subtractions; wider
+ * values (only possible when M is less than half the width) are folded in k limbs at a time.
+ * A single-limb M uses a precomputed limb reciprocal instead, one division step per limb.
+ *
+ * @tparam BitSize Width of the modulus and of the values reduced by it.
+ */
+template<size_t BitSize>
+class BarrettReducer {
+public:
+    static constexpr size_t LimbCount = LimbCountForBits(BitSize);
+    using LimbArray = std::array<Limb, LimbCount>;
+
+    // Throws std::runtime_error for a zero modulus, like operator%
+    template<size_t BitOffset, typename StorageProviderType>
+    explicit BarrettReducer(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus);
+
+    // value mod M
+    template<size_t BitOffset, typename StorageProviderType>
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> Reduce(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value) const;
+
+    // out[i] = in[i] mod M; the spans must have the same length and may be the same span
+    template<size_t BitOffset, typename StorageProviderType>
+    void Reduce(std::span<const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> in, std::span<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> out) const;
+
+    // Limb-level form: r = x mod M over LimbCount limbs, r may alias x
+    void Reduce(Limb* r, const Limb* x) const;
+
+    const LimbArray& GetModulus() const {
+        return modulus_;
+    }
+
+private:
+    // Window of up to 2k limbs
+    using Window = std::array<Limb, 2 * LimbCount>;
+
+    // r = window mod M for a window of length limbs, length <= 2k; r receives k limbs
+    void ReduceWindow(Limb* r, const Limb* window, size_t length) const;
+
+    LimbArray modulus_;
+    std::array<Limb, LimbCount + 2> mu_; // floor(2^(128k) / M); k + 2 limbs only when M = 2^(64(k - 1))
+    size_t modulusLimbs_; // k
+    size_t muLimbs_;
+    Limb reciprocal_; // single-limb M: reciprocal of M << shift_
+    unsigned shift_;
+};
+
+#include <core/modular/impl/barrett.inl>
+
+#endif //BARRETTREDUCER_H
@@ -0,0 +1,91 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef MONTGOMERYCONTEXT_H
+#define MONTGOMERYCONTEXT_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <core/limb/LimbEngine.h>
+#include <core/unsigned-int/ArbitraryUnsignedInt.h>
+
+/**
+ * @brief Modular multiplication and exponentiation for a fixed odd modulus in Montgomery form.
+ *
+ * R = 2^(64 * LimbCount). The context keeps the modulus N, R^2 mod N and -N^-1 mod 2^64, so entering
+ * the Montgomery domain is one multiplication by R^2 and leaving it is one multiplication by 1.
+ * Values of any offset or storage provider with BitSize bits can be used with the same context.
+ * The multiplication kernels run in constant time; only ModPow's sliding window depends on the
+ * exponent bits.
+ *
+ * @tparam BitSize Width of the modulus and of the values reduced by it.
+ */
+template<size_t BitSize>
+class MontgomeryContext {
+public:
+    static constexpr size_t LimbCount = LimbCountForBits(BitSize);
+    using LimbArray = std::array<Limb, LimbCount>;
+
+    // The modulus has to be odd; throws std::invalid_argument otherwise
+    template<size_t BitOffset, typename StorageProviderType>
+    explicit MontgomeryContext(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus);
+
+    // (a * b) mod N
+    template<size_t BitOffset, typename StorageProviderType>
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ModMul(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) const;
+
+    // base^exponent mod N by sliding-window exponentiation; the exponent may have any width.
+    // Goes to ModPowConstantTime when either operand comes from a ConstantTimeProvider.
+    template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ModPow(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const;
+
+    // Constant-time base^exponent mod N: fixed 4-bit windows over every exponent bit, with the
+    // table entry read by a masked scan of the whole table
+    template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ModPowConstantTime(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const;
+
+    // Constant-time base^exponent mod N by the Montgomery ladder: one multiply and one square per
+    // exponent bit and no table, at roughly twice the cost of the windowed form
+    template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ModPowLadder(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const;
+
+    // Limb-level access to the Montgomery domain. Inputs need not be reduced; outputs are below N.
+    LimbArray ToMontgomery(const LimbArray& value) const; // value * R mod N
+    LimbArray FromMontgomery(const LimbArray& value) const; // value / R mod N
+    void Multiply(Limb* r, const Limb* a, const Limb* b) const; // a * b / R mod N, r may alias a or b
+    void Square(Limb* r, const Limb* a) const; // a * a / R mod N, r may alias a
+
+    // Window width used by ModPow for an exponent with the given number of significant bits
+    static constexpr unsigned WindowBits(size_t exponentBits);
+
+    const LimbArray& GetModulus() const {
+        return modulus_;
+    }
+    const LimbArray& GetRSquared() const {
+        return rSquared_;
+    }
+    Limb GetInverse() const {
+        return inverse_;
+    }
+
+private:
+    LimbArray modulus_;
+    LimbArray rSquared_; // R^2 mod N
+    LimbArray one_; // R mod N, the Montgomery form of 1
+    Limb inverse_; // -N^-1 mod 2^64
+};
+
+// One-shot base^exponent mod modulus; build a MontgomeryContext to reuse the precomputation
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
+ModPow(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus) {
+    return MontgomeryContext<BitSize>(modulus).ModPow(base, exponent);
+}
+
+#include <core/modular/impl/montgomery.inl>
+
+#endif //MONTGOMERYCONTEXT_H
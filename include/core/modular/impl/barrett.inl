@@ -0,0 +1,136 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef MODULAR_BARRETT_INL
+#define MODULAR_BARRETT_INL
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType>
+BarrettReducer<BitSize>::BarrettReducer(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus)
+    : modulus_(modulus.ToLimbs()), mu_{}, modulusLimbs_(LimbCount), muLimbs_(0), reciprocal_(0), shift_(0) {
+    while (modulusLimbs_ > 0 && modulus_[modulusLimbs_ - 1] == 0) {
+        --modulusLimbs_;
+    }
+    if (modulusLimbs_ == 0) {
+        throw std::runtime_error("Division by zero");
+    }
+
+    // A single-limb modulus keeps the normalized divisor and its reciprocal instead
+    if (modulusLimbs_ == 1) {
+        shift_ = std::countl_zero(modulus_[0]);
+        reciprocal_ = LimbReciprocal(modulus_[0] << shift_);
+        return;
+    }
+
+    // mu = floor(2^(128k) / M) from the division kernel, done once per reducer
+    const size_t k = modulusLimbs_;
+    std::array<Limb, 2 * LimbCount + 1> power{};
+    power[2 * k] = 1;
+    std::array<Limb, 2 * LimbCount + 1> quotient;
+    LimbArray remainder;
+    std::array<Limb, LimbDivRemScratchSize(2 * LimbCount + 1, LimbCount)> scratch;
+    LimbDivRem(quotient.data(), remainder.data(), power.data(), 2 * k + 1, modulus_.data(), k, scratch.data());
+    muLimbs_ = k + 2;
+    while (muLimbs_ > 1 && quotient[muLimbs_ - 1] == 0) {
+        --muLimbs_;
+    }
+    std::copy(quotient.begin(), quotient.begin() + muLimbs_, mu_.begin());
+}
+
+template<size_t BitSize>
+void BarrettReducer<BitSize>::ReduceWindow(Limb* r, const Limb* window, size_t length) const {
+    const size_t k = modulusLimbs_;
+    if (length < k) {
+        // Already below 2^(64(k - 1)) <= M
+        std::copy(window, window + length, r);
+        std::fill(r + length, r + k, Limb{0});
+        return;
+    }
+
+    // HAC 14.42 with base 2^64: q3 = floor(floor(x / b^(k-1)) * mu / b^(k+1)) is at most two short
+    // of the quotient. Only the significant limbs of x take part, so a short x gives a short q3.
+    const size_t q1Limbs = length - (k - 1);
+    std::array<Limb, 2 * LimbCount + 3> q2;
+    LimbMulSchoolbook(q2.data(), mu_.data(), muLimbs_, window + k - 1, q1Limbs);
+    const Limb* q3 = q2.data() + k + 1;
+    const size_t q3Limbs = std::min(q1Limbs + muLimbs_ - (k + 1), k + 1);
+
+    // r = x - q3 * M mod b^(k+1); the wrap is exactly the "add b^(k+1) if negative" step
+    std::array<Limb, 2 * LimbCount + 2> product;
+    LimbMulSchoolbook(product.data(), modulus_.data(), k, q3, q3Limbs);
+    std::array<Limb, LimbCount + 1> remainder{};
+    std::copy(window, window + std::min(length, k + 1), remainder.begin());
+    LimbSubN(remainder.data(), remainder.data(), product.data(), k + 1);
+
+    while (remainder[k] != 0 || LimbCompare(remainder.data(), modulus_.data(), k) >= 0) {
+        remainder[k] -= LimbSubN(remainder.data(), remainder.data(), modulus_.data(), k);
+    }
+    std::copy(remainder.begin(), remainder.begin() + k, r);
+}
+
+template<size_t BitSize>
+void BarrettReducer<BitSize>::Reduce(Limb* r, const Limb* x) const {
+    const size_t k = modulusLimbs_;
+    if (k == 1) {
+        // One reciprocal division per limb of x, shifted on the fly against the normalized divisor
+        const Limb divisor = modulus_[0] << shift_;
+        Limb remainder = shift_ == 0 ? 0 : x[LimbCount - 1] >> (LimbBits - shift_);
+        for (size_t i = LimbCount; i-- > 0;) {
+            const Limb shifted = shift_ == 0 || i == 0 ? x[i] << shift_ : (x[i] << shift_) | (x[i - 1] >> (LimbBits - shift_));
+            LimbDivPreinv(remainder, shifted, divisor, reciprocal_, remainder);
+        }
+        std::fill(r, r + LimbCount, Limb{0});
+        r[0] = remainder >> shift_;
+        return;
+    }
+    size_t remaining = LimbCount;
+    while (remaining > 0 && x[remaining - 1] == 0) {
+        --remaining;
+    }
+
+    // Top 2k limbs first, then fold in k limbs at a time below the running remainder, which keeps
+    // every window under M * 2^(64k) < 2^(128k)
+    size_t take = std::min(remaining, 2 * k);
+    remaining -= take;
+    LimbArray remainder{};
+    ReduceWindow(remainder.data(), x + remaining, take);
+
+    Window window;
+    while (remaining > 0) {
+        take = std::min(remaining, k);
+        remaining -= take;
+        std::copy(x + remaining, x + remaining + take, window.begin());
+        std::copy(remainder.begin(), remainder.begin() + k, window.begin() + take);
+        ReduceWindow(remainder.data(), window.data(), take + k);
+    }
+    std::copy(remainder.begin(), remainder.end(), r);
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> BarrettReducer<BitSize>::Reduce(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value) const {
+    LimbArray limbs = value.ToLimbs();
+    Reduce(limbs.data(), limbs.data());
+
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(limbs.data());
+    return result;
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType>
+void BarrettReducer<BitSize>::Reduce(std::span<const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> in, std::span<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> out) const {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output spans must have the same length");
+    }
+    // One limb buffer for the whole batch, written back in place
+    LimbArray limbs;
+    for (size_t i = 0; i < in.size(); ++i) {
+        limbs = in[i].ToLimbs();
+        Reduce(limbs.data(), limbs.data());
+        out[i].FromLimbs(limbs.data());
+    }
+}
+
+#endif //MODULAR_BARRETT_INL
@@ -0,0 +1,204 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef MODULAR_MONTGOMERY_INL
+#define MODULAR_MONTGOMERY_INL
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType>
+MontgomeryContext<BitSize>::MontgomeryContext(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus)
+    : modulus_(modulus.ToLimbs()) {
+    if ((modulus_[0] & 1) == 0) {
+        throw std::invalid_argument("Montgomery modulus must be odd");
+    }
+    inverse_ = LimbMontgomeryInverse(modulus_[0]);
+
+    // R^2 mod N straight from the division kernel, done once per context
+    constexpr size_t wideCount = 2 * LimbCount + 1;
+    std::vector<Limb> wide(wideCount, 0);
+    wide[2 * LimbCount] = 1;
+    std::vector<Limb> quotient(wideCount);
+    std::vector<Limb> scratch(LimbDivRemScratchSize(wideCount, LimbCount));
+    LimbDivRem(quotient.data(), rSquared_.data(), wide.data(), wideCount, modulus_.data(), LimbCount, scratch.data());
+
+    one_ = ToMontgomery(LimbArray{1});
+}
+
+template<size_t BitSize>
+void MontgomeryContext<BitSize>::Multiply(Limb* r, const Limb* a, const Limb* b) const {
+    std::array<Limb, LimbMontgomeryScratchSize(LimbCount)> scratch;
+    LimbMontgomeryMul(r, a, b, modulus_.data(), LimbCount, inverse_, scratch.data());
+}
+
+template<size_t BitSize>
+void MontgomeryContext<BitSize>::Square(Limb* r, const Limb* a) const {
+    std::array<Limb, LimbMontgomeryScratchSize(LimbCount)> scratch;
+    LimbMontgomerySqr(r, a, modulus_.data(), LimbCount, inverse_, scratch.data());
+}
+
+template<size_t BitSize>
+typename MontgomeryContext<BitSize>::LimbArray MontgomeryContext<BitSize>::ToMontgomery(const LimbArray& value) const {
+    // value < R and R^2 mod N < N keep the product under R * N, so no reduction is needed first
+    LimbArray result;
+    Multiply(result.data(), value.data(), rSquared_.data());
+    return result;
+}
+
+template<size_t BitSize>
+typename MontgomeryContext<BitSize>::LimbArray MontgomeryContext<BitSize>::FromMontgomery(const LimbArray& value) const {
+    LimbArray result;
+    Multiply(result.data(), value.data(), LimbArray{1}.data());
+    return result;
+}
+
+template<size_t BitSize>
+constexpr unsigned MontgomeryContext<BitSize>::WindowBits(size_t exponentBits) {
+    // Width that minimizes table setup plus one multiplication per window
+    if (exponentBits <= 24) {
+        return 1;
+    }
+    if (exponentBits <= 80) {
+        return 3;
+    }
+    if (exponentBits <= 240) {
+        return 4;
+    }
+    if (exponentBits <= 672) {
+        return 5;
+    }
+    return 6;
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> MontgomeryContext<BitSize>::ModMul(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) const {
+    // (a R^2 / R) * b / R = a * b / R^0
+    LimbArray product = ToMontgomery(a.ToLimbs());
+    const LimbArray multiplier = b.ToLimbs();
+    Multiply(product.data(), product.data(), multiplier.data());
+
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(product.data());
+    return result;
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> MontgomeryContext<BitSize>::ModPow(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const {
+    if constexpr (ConstantTimeProvider<StorageProviderType> || ConstantTimeProvider<ExponentStorageProviderType>) {
+        return ModPowConstantTime(base, exponent);
+    }
+
+    const auto exponentLimbs = exponent.ToLimbs();
+    const auto bitAt = [&exponentLimbs](size_t index) -> unsigned {
+        return (exponentLimbs[index / LimbBits] >> (index % LimbBits)) & 1;
+    };
+    size_t exponentBits = exponentLimbs.size() * LimbBits;
+    while (exponentBits > 0 && bitAt(exponentBits - 1) == 0) {
+        --exponentBits;
+    }
+
+    // Odd powers base^1, base^3, ..., base^(2^window - 1) in Montgomery form
+    const unsigned window = WindowBits(exponentBits);
+    std::array<LimbArray, size_t{1} << 5> table;
+    table[0] = ToMontgomery(base.ToLimbs());
+    if (window > 1) {
+        LimbArray square;
+        Square(square.data(), table[0].data());
+        for (size_t i = 1; i < (size_t{1} << (window - 1)); ++i) {
+            Multiply(table[i].data(), table[i - 1].data(), square.data());
+        }
+    }
+
+    // Left to right: square through zero bits, and take each window that starts and ends on a one
+    LimbArray accumulator = one_;
+    size_t index = exponentBits;
+    while (index > 0) {
+        if (bitAt(index - 1) == 0) {
+            Square(accumulator.data(), accumulator.data());
+            --index;
+            continue;
+        }
+        size_t low = index > window ? index - window : 0;
+        while (bitAt(low) == 0) {
+            ++low;
+        }
+        size_t value = 0;
+        for (size_t i = index; i > low; --i) {
+            Square(accumulator.data(), accumulator.data());
+            value = (value << 1) | bitAt(i - 1);
+        }
+        Multiply(accumulator.data(), accumulator.data(), table[value >> 1].data());
+        index = low;
+    }
+
+    const LimbArray plain = FromMontgomery(accumulator);
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(plain.data());
+    return result;
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> MontgomeryContext<BitSize>::ModPowConstantTime(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const {
+    constexpr size_t window = 4;
+    constexpr size_t tableSize = size_t{1} << window;
+    const auto exponentLimbs = exponent.ToLimbs();
+
+    // base^0 .. base^15 in Montgomery form, in one flat block for LimbCtLookup
+    std::array<Limb, tableSize * LimbCount> table;
+    std::copy(one_.begin(), one_.end(), table.begin());
+    const LimbArray power = ToMontgomery(base.ToLimbs());
+    std::copy(power.begin(), power.end(), table.begin() + LimbCount);
+    for (size_t i = 2; i < tableSize; ++i) {
+        Multiply(table.data() + i * LimbCount, table.data() + (i - 1) * LimbCount, power.data());
+    }
+
+    // Every window of the full exponent width is squared through and multiplied in, zero or not
+    constexpr size_t windows = (ExponentBitSize + window - 1) / window;
+    LimbArray accumulator = one_;
+    LimbArray entry;
+    for (size_t w = windows; w-- > 0;) {
+        for (size_t i = 0; i < window; ++i) {
+            Square(accumulator.data(), accumulator.data());
+        }
+        const size_t bit = w * window;
+        size_t digit = exponentLimbs[bit / LimbBits] >> (bit % LimbBits);
+        if (bit % LimbBits + window > LimbBits && bit / LimbBits + 1 < exponentLimbs.size()) {
+            digit |= exponentLimbs[bit / LimbBits + 1] << (LimbBits - bit % LimbBits);
+        }
+        LimbCtLookup(entry.data(), table.data(), tableSize, LimbCount, digit & (tableSize - 1));
+        Multiply(accumulator.data(), accumulator.data(), entry.data());
+    }
+
+    const LimbArray plain = FromMontgomery(accumulator);
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(plain.data());
+    return result;
+}
+
+template<size_t BitSize>
+template<size_t BitOffset, typename StorageProviderType, size_t ExponentBitSize, size_t ExponentBitOffset, typename ExponentStorageProviderType>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> MontgomeryContext<BitSize>::ModPowLadder(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& base, const ArbitraryUnsignedInt<ExponentBitSize, ExponentBitOffset, ExponentStorageProviderType>& exponent) const {
+    const auto exponentLimbs = exponent.ToLimbs();
+
+    // Invariant: high = low * base. Each bit picks which of the two gets squared by swapping
+    // them in and out with a mask, so both branches do the same work.
+    LimbArray low = one_;
+    LimbArray high = ToMontgomery(base.ToLimbs());
+    for (size_t i = ExponentBitSize; i-- > 0;) {
+        const Limb swap = LimbCtMask((exponentLimbs[i / LimbBits] >> (i % LimbBits)) & 1);
+        LimbCtSwap(low.data(), high.data(), LimbCount, swap);
+        Multiply(high.data(), low.data(), high.data());
+        Square(low.data(), low.data());
+        LimbCtSwap(low.data(), high.data(), LimbCount, swap);
+    }
+
+    const LimbArray plain = FromMontgomery(low);
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+    result.FromLimbs(plain.data());
+    return result;
+}
+
+#endif //MODULAR_MONTGOMERY_INL
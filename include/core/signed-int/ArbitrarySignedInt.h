@@ -11,11 +11,13 @@
 #include <array>
 #include <iostream>
 #include <utility>
+#include <functional>
 
 #include <concepts/StorageProvider.h>
+#include <core/limb/LimbEngine.h>
 
 // Forward declaration - don't include the header
-template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 class ArbitraryUnsignedInt;
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -122,6 +124,9 @@ public:
     bool operator>=(const ArbitrarySignedInt& other) const;
     std::strong_ordering operator<=>(const ArbitrarySignedInt& other) const;
 
+    // Hash of the BitSize value bits only, read straight from storage; consistent with operator==
+    uint64_t Hash() const;
+
     // Increment/decrement
     ArbitrarySignedInt& operator++(); // prefix
     ArbitrarySignedInt operator++(int); // postfix
@@ -180,6 +185,12 @@ public:
         return storage_;
     }
 
+    // Limb view of the value (two's complement), for internal use by the limb kernels
+    static constexpr size_t LimbCount = LimbCountForBits(BitSize);
+    using LimbArray = std::array<Limb, LimbCount>;
+    LimbArray ToLimbs() const; // bits above BitSize are copies of the sign bit
+    void FromLimbs(const Limb* limbs); // reads LimbCount limbs, keeps the low BitSize bits
+
     // Division operations with both quotient and remainder
     std::pair<ArbitrarySignedInt, ArbitrarySignedInt> DivRem(const ArbitrarySignedInt& other) const;
     std::pair<ArbitrarySignedInt, ArbitrarySignedInt> DivEuclid(const ArbitrarySignedInt& other) const;
@@ -312,6 +323,16 @@ using Int128 = ArbitrarySignedInt<128, 0, StorageProvider>;
 template<typename StorageProvider>
 using Int256 = ArbitrarySignedInt<256, 0, StorageProvider>;
 
+// Hash support so the type can key unordered containers. Only the value bits take part, so equal
+// values hash alike whatever their offset, storage provider or neighbouring bits. Lookups are not
+// heterogeneous: operator== only compares values of the same type.
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+struct std::hash<ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>> {
+    size_t operator()(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value) const noexcept {
+        return static_cast<size_t>(value.Hash());
+    }
+};
+
 #include <core/signed-int/impl/ArbitrarySignedIntImpl.h>
 
 
@@ -15,6 +15,7 @@
 #include <core/signed-int/impl/comparison.inl>
 #include <core/signed-int/impl/constructor.inl>
 #include <core/signed-int/impl/conversions.inl>
+#include <core/signed-int/impl/limb_access.inl>
 #include <core/signed-int/impl/overflowing_ops.inl>
 #include <core/signed-int/impl/saturating_ops.inl>
 #include <core/signed-int/impl/static_properties.inl>
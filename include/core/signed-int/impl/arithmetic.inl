@@ -7,54 +7,72 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+(const ArbitrarySignedInt& other) const {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+(const ArbitrarySignedInt& other) not implemented.");
+    // Two's complement addition is the unsigned one; the wrap past BitSize is dropped by FromLimbs
+    const LimbArray augend = ToLimbs();
+    const LimbArray addend = other.ToLimbs();
+    LimbArray sum;
+    LimbAddN(sum.data(), augend.data(), addend.data(), LimbCount);
+
+    ArbitrarySignedInt result;
+    result.FromLimbs(sum.data());
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-(const ArbitrarySignedInt& other) const {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-(const ArbitrarySignedInt& other) not implemented.");
+    const LimbArray minuend = ToLimbs();
+    const LimbArray subtrahend = other.ToLimbs();
+    LimbArray difference;
+    LimbSubN(difference.data(), minuend.data(), subtrahend.data(), LimbCount);
+
+    ArbitrarySignedInt result;
+    result.FromLimbs(difference.data());
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*(const ArbitrarySignedInt& other) const {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*(const ArbitrarySignedInt& other) not implemented.");
+    // The low BitSize bits of a two's complement product match the unsigned product of the same bit patterns
+    const LimbArray multiplicand = ToLimbs();
+    const LimbArray multiplier = other.ToLimbs();
+    LimbArray product;
+    LimbMulLowFixed<LimbCount>(product.data(), multiplicand.data(), multiplier.data());
+
+    ArbitrarySignedInt result;
+    result.FromLimbs(product.data());
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/(const ArbitrarySignedInt& other) const {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/(const ArbitrarySignedInt& other) not implemented.");
+    return DivRem(other).first;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%(const ArbitrarySignedInt& other) const {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%(const ArbitrarySignedInt& other) not implemented.");
+    return DivRem(other).second;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+=(const ArbitrarySignedInt& other) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+=(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator+=(const ArbitrarySignedInt& other) not implemented.");
+    *this = *this + other;
+    return *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-=(const ArbitrarySignedInt& other) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-=(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-=(const ArbitrarySignedInt& other) not implemented.");
+    *this = *this - other;
+    return *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*=(const ArbitrarySignedInt& other) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*=(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator*=(const ArbitrarySignedInt& other) not implemented.");
+    *this = *this * other;
+    return *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/=(const ArbitrarySignedInt& other) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/=(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator/=(const ArbitrarySignedInt& other) not implemented.");
+    *this = *this / other;
+    return *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%=(const ArbitrarySignedInt& other) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%=(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator%=(const ArbitrarySignedInt& other) not implemented.");
+    *this = *this % other;
+    return *this;
 }
 
 #endif //ARBITRARYSIGNEDINT_ARITHMETIC_INL
@@ -7,15 +7,21 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::RotateLeft(size_t n) const {
-    return storage_.RotateLeft(n);
+    ArbitrarySignedInt result = *this;
+    result.storage_.RotateRangeLeft(BitOffset, BitSize, n);
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::RotateRight(size_t n) const {
-    return storage_.RotateRight(n);
+    ArbitrarySignedInt result = *this;
+    result.storage_.RotateRangeRight(BitOffset, BitSize, n);
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ReverseBits() const {
-    return storage_.ReverseBits();
+    ArbitrarySignedInt result = *this;
+    result.storage_.ReverseBitRange(BitOffset, BitSize);
+    return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ReverseBytes() const {
@@ -30,14 +30,14 @@ template<size_t BitSize, size_t BitOffset, typename StorageProviderType> require
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<<(size_t shift) const {
     ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> result;
     result.storage_ = this->storage_;
-    result.storage_.ShiftLeft(shift);
+    result.storage_.ShiftRangeLeft(BitOffset, BitSize, shift);
     return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>>(size_t shift) const {
     ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> result;
     result.storage_ = this->storage_;
-    result.storage_.ShiftRight(shift);
+    result >>= shift;
     return result;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -57,12 +57,18 @@ ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<<=(size_t shift) {
-    this->storage_.ShiftLeft(shift);
+    this->storage_.ShiftRangeLeft(BitOffset, BitSize, shift);
     return *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>>=(size_t shift) {
-    this->storage_.ShiftRight(shift);
+    // Arithmetic shift: the vacated high bits take the sign
+    const bool negative = IsNegative();
+    this->storage_.ShiftRangeRight(BitOffset, BitSize, shift);
+    if (negative) {
+        const size_t filled = std::min(shift, BitSize);
+        this->storage_.SetBitRange(BitOffset + BitSize - filled, filled);
+    }
     return *this;
 }
 
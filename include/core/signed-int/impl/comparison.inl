@@ -7,41 +7,80 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator==(const ArbitrarySignedInt& other) const {
-    for (size_t i = 0; i < BitSize; ++i) {
-        if (GetBit(BitOffset + i) != other.GetBit(BitOffset + i)) {
+    if constexpr (BitOffset % 8 == 0) {
+        // Byte-aligned: memcmp over the whole bytes, then the masked tail byte
+        constexpr size_t fullBytes = BitSize / 8;
+        const uint8_t* lhs = storage_.Data() + BitOffset / 8;
+        const uint8_t* rhs = other.storage_.Data() + BitOffset / 8;
+        if (std::memcmp(lhs, rhs, fullBytes) != 0) {
             return false;
         }
+        if constexpr (BitSize % 8 != 0) {
+            constexpr uint8_t tailMask = (1u << (BitSize % 8)) - 1;
+            return ((lhs[fullBytes] ^ rhs[fullBytes]) & tailMask) == 0;
+        }
+        return true;
+    }
+    else {
+        // Limb-wise, masking the bits that share the storage above the value
+        for (size_t i = 0; i < LimbCount; ++i) {
+            const Limb difference = storage_.LoadLimb(BitOffset + i * LimbBits) ^ other.storage_.LoadLimb(BitOffset + i * LimbBits);
+            if ((difference & LimbMask(BitSize - i * LimbBits)) != 0) {
+                return false;
+            }
+        }
+        return true;
     }
-    return true;
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator!=(const ArbitrarySignedInt& other) const {
     return !(*this == other);
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<(const ArbitrarySignedInt& other) const {
-    // TODO: Implement bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<(const ArbitrarySignedInt& other)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<(const ArbitrarySignedInt& other) not implemented.");
+    return (*this <=> other) < 0;
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=(const ArbitrarySignedInt& other) const {
-    // TODO: Implement bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=(const ArbitrarySignedInt& other)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=(const ArbitrarySignedInt& other) not implemented.");
+    return (*this <=> other) <= 0;
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>(const ArbitrarySignedInt& other) const {
-    // TODO: Implement bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>(const ArbitrarySignedInt& other)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>(const ArbitrarySignedInt& other) not implemented.");
+    return (*this <=> other) > 0;
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>=(const ArbitrarySignedInt& other) const {
-    // TODO: Implement bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>=(const ArbitrarySignedInt& other)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator>=(const ArbitrarySignedInt& other) not implemented.");
+    return (*this <=> other) >= 0;
 }
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::strong_ordering ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=>(const ArbitrarySignedInt& other) const {
-    // TODO: Implement std::partial_ordering ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=>(const ArbitrarySignedInt& other)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator<=>(const ArbitrarySignedInt& other) not implemented.");
+    // Most significant limb first; flipping the sign bit of the top limb turns the signed order into the unsigned one
+    constexpr size_t topBits = BitSize - (LimbCount - 1) * LimbBits;
+    constexpr Limb signBit = Limb{1} << (topBits - 1);
+    for (size_t i = LimbCount; i-- > 0;) {
+        const Limb mask = LimbMask(BitSize - i * LimbBits);
+        const Limb flip = i == LimbCount - 1 ? signBit : 0;
+        const Limb lhs = (storage_.LoadLimb(BitOffset + i * LimbBits) & mask) ^ flip;
+        const Limb rhs = (other.storage_.LoadLimb(BitOffset + i * LimbBits) & mask) ^ flip;
+        if (lhs != rhs) {
+            return lhs <=> rhs;
+        }
+    }
+    return std::strong_ordering::equal;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+uint64_t ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::Hash() const {
+    // Same limbs operator== compares, with the bits above the value masked off
+    return LimbHashLimbs([this](size_t i) {
+        return storage_.LoadLimb(BitOffset + i * LimbBits) & LimbMask(BitSize - i * LimbBits);
+    }, LimbCount);
 }
 
 #endif //ARBITRARYSIGNEDINT_COMPARISON_INL
@@ -15,29 +15,33 @@ ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ArbitrarySignedInt(
     using UnsignedT = std::make_unsigned_t<T>;
     UnsignedT bits = std::bit_cast<UnsignedT>(value);
 
-    // truncate it
-    if constexpr (BitSize < sizeof(T) * 8) {
-        constexpr UnsignedT mask = (1ULL << BitSize) - 1;
-        bits &= mask;
+    // Spread the value over limbs, sign-extending negative values; FromLimbs truncates it to BitSize
+    LimbArray limbs;
+    const Limb fill = std::is_signed_v<T> && value < 0 ? ~Limb{0} : 0;
+    for (size_t i = 0; i < LimbCount; ++i) {
+        limbs[i] = i * LimbBits < sizeof(T) * 8 ? static_cast<Limb>(bits >> (i * LimbBits)) : fill;
     }
-
-    // Use IByteCopyable interface for efficient storage operations
-    const uint8_t* byte_data = std::bit_cast<const uint8_t*>(&bits);
-    // Round up to bytes
-    size_t byte_count = std::min(sizeof(bits), (BitSize + 7) / 8);
-
-    storage_.CopyFromBytes(byte_data,
-        sizeof(bits),
-        0,
-        // srcStart
-        BitOffset / 8,
-        // dstStart (convert bit offset to byte offset)
-        byte_count); // copyCount
+    if constexpr (sizeof(T) < sizeof(Limb)) {
+        limbs[0] |= fill << (sizeof(T) * 8);
+    }
+    FromLimbs(limbs.data());
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ArbitrarySignedInt(const std::string& str, int base) {
-    // TODO: Implement ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ArbitrarySignedInt(const std::string& str, int base)
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ArbitrarySignedInt(const std::string& str, int base) not implemented.");
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Invalid base");
+    }
+    // Optional sign, then the magnitude through the unsigned radix conversion
+    const bool negative = !str.empty() && str[0] == '-';
+    const size_t start = !str.empty() && (str[0] == '-' || str[0] == '+') ? 1 : 0;
+    LimbArray limbs;
+    if (!LimbFromString(limbs.data(), LimbCount, std::string_view(str).substr(start), static_cast<unsigned>(base))) {
+        throw std::invalid_argument("Invalid character in string");
+    }
+    if (negative) {
+        LimbNeg(limbs.data(), limbs.data(), LimbCount);
+    }
+    FromLimbs(limbs.data());
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 template<typename T, typename>
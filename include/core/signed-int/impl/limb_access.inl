@@ -0,0 +1,31 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYSIGNEDINT_LIMB_ACCESS_INL
+#define ARBITRARYSIGNEDINT_LIMB_ACCESS_INL
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+typename ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::LimbArray ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ToLimbs() const {
+    LimbArray limbs;
+    for (size_t i = 0; i < LimbCount; ++i) {
+        limbs[i] = storage_.LoadLimb(BitOffset + i * LimbBits);
+    }
+    // Replace whatever shares the storage above the value with the sign
+    constexpr size_t topBits = BitSize - (LimbCount - 1) * LimbBits;
+    const bool negative = (limbs[LimbCount - 1] >> (topBits - 1)) & 1;
+    limbs[LimbCount - 1] &= LimbMask(topBits);
+    if (negative) {
+        limbs[LimbCount - 1] |= ~LimbMask(topBits);
+    }
+    return limbs;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+void ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::FromLimbs(const Limb* limbs) {
+    for (size_t i = 0; i < LimbCount; ++i) {
+        storage_.StoreLimb(BitOffset + i * LimbBits, limbs[i], std::min(LimbBits, BitSize - i * LimbBits));
+    }
+}
+
+#endif //ARBITRARYSIGNEDINT_LIMB_ACCESS_INL
@@ -7,25 +7,25 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::IsNegative() const {
-    return storage_.GetBit(BitSize - 1);
+    return storage_.GetBit(BitOffset + BitSize - 1);
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::IsPositive() const {
-    return !storage_.GetBit(BitSize - 1) && !storage_.IsZero();
+    return !IsNegative() && !IsZero();
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 int ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::Sign() const {
-    if (storage_.IsZero()) {
+    if (IsZero()) {
         return 0;
     }
-    return storage_.GetBit(BitSize - 1) ?
+    return IsNegative() ?
                -1 :
                1;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::Max() {
     ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> max;
-    max.storage_.SetAllBits();
+    max.storage_.SetBitRange(BitOffset, BitSize - 1);
     return max;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -7,45 +7,17 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::string ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ToString(int base) const {
-    if (storage_.IsAllZeros()) {
-        return "0";
+    if (base < 2 || base > 36) {
+        throw std::invalid_argument("Base must be between 2 and 36");
     }
 
-    std::string result;
-    bool is_negative = IsNegative();
-    auto temp_storage = storage_;
-
-    if (is_negative) {
-        // Convert to positive for easier processing
-        temp_storage.BitwiseNot();
-        temp_storage.Increment();
-    }
-
-    auto temp_storage_clone = temp_storage.Clone();
-    while (!temp_storage_clone->IsAllZeros()) {
-        int remainder = 0;
-        auto new_storage = temp_storage.Clone();
-        new_storage->ClearAllBits();
-        for (size_t i = temp_storage_clone->GetBitSize(); i > 0; --i) {
-            remainder <<= 1;
-            if (temp_storage_clone->GetBit(i - 1)) {
-                remainder |= 1;
-            }
-            if (remainder >= base) {
-                new_storage->SetBit(i - 1);
-                remainder -= base;
-            }
-        }
-        result += "0123456789abcdef"[remainder];
-        temp_storage_clone = std::move(new_storage);
+    // Sign, then the magnitude through the unsigned radix conversion
+    LimbArray limbs = ToLimbs();
+    if (!IsNegative()) {
+        return LimbToString(limbs.data(), LimbCount, static_cast<unsigned>(base));
     }
-
-    if (is_negative) {
-        result += "-";
-    }
-
-    std::ranges::reverse(result);
-    return result;
+    LimbNeg(limbs.data(), limbs.data(), LimbCount);
+    return "-" + LimbToString(limbs.data(), LimbCount, static_cast<unsigned>(base));
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::string ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::ToBinaryString() const {
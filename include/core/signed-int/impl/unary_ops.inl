@@ -7,7 +7,12 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::operator-() const {
-    return this->operator~()++;
+    LimbArray limbs = ToLimbs();
+    LimbNeg(limbs.data(), limbs.data(), LimbCount);
+
+    ArbitrarySignedInt result;
+    result.FromLimbs(limbs.data());
+    return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -7,14 +7,44 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::Abs() const {
-    this->storage_.ClearBit(BitSize - 1);
-    return *this;
+    return IsNegative() ? -*this : *this;
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::pair<ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>, ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> >
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::DivRem(const ArbitrarySignedInt& other) const {
-    // TODO: Implement std::pair<ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>, ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> > DivRem(const ArbitrarySignedInt& other) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::DivRem(const ArbitrarySignedInt& other) not implemented.");
+    LimbArray dividend = ToLimbs();
+    LimbArray divisor = other.ToLimbs();
+
+    // Division by zero check
+    if (std::all_of(divisor.begin(), divisor.end(), [](Limb limb) { return limb == 0; })) {
+        throw std::runtime_error("Division by zero");
+    }
+
+    // Divide the magnitudes; the quotient truncates toward zero and the remainder takes the dividend's sign
+    const bool dividendNegative = IsNegative();
+    const bool divisorNegative = other.IsNegative();
+    if (dividendNegative) {
+        LimbNeg(dividend.data(), dividend.data(), LimbCount);
+    }
+    if (divisorNegative) {
+        LimbNeg(divisor.data(), divisor.data(), LimbCount);
+    }
+    LimbArray quotientLimbs;
+    LimbArray remainderLimbs;
+    std::array<Limb, LimbDivRemScratchSize(LimbCount, LimbCount)> scratch;
+    LimbDivRem(quotientLimbs.data(), remainderLimbs.data(), dividend.data(), LimbCount, divisor.data(), LimbCount, scratch.data());
+    if (dividendNegative != divisorNegative) {
+        LimbNeg(quotientLimbs.data(), quotientLimbs.data(), LimbCount);
+    }
+    if (dividendNegative) {
+        LimbNeg(remainderLimbs.data(), remainderLimbs.data(), LimbCount);
+    }
+
+    ArbitrarySignedInt quotient;
+    ArbitrarySignedInt remainder;
+    quotient.FromLimbs(quotientLimbs.data());
+    remainder.FromLimbs(remainderLimbs.data());
+    return { quotient, remainder };
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::pair<ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>, ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> >
@@ -80,8 +110,7 @@ void ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::SignExtend() {
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> Abs(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value) {
-    // TODO: Implement Abs(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::Abs(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& value) not implemented.");
+    return value.Abs();
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType> Gcd(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& b) {
@@ -110,8 +139,25 @@ ArbitrarySignedInt<BitSize * 2, BitOffset, StorageProviderType> WideningLcm(cons
 }
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitrarySignedInt<BitSize * 2, BitOffset, StorageProviderType> WideningMul(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& b) {
-    // TODO: Implement WideningMul(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& b) not implemented.");
-    throw std::runtime_error("ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>::WideningMul(const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>& b) not implemented.");
+    // Unsigned product of the sign-extended limbs, then subtract the other operand from the high half
+    // for each negative operand: (a + 2^W sa)(b + 2^W sb) = ab + 2^W (sa b + sb a) mod 2^2W
+    using Operand = ArbitrarySignedInt<BitSize, BitOffset, StorageProviderType>;
+    using Wide = ArbitrarySignedInt<BitSize * 2, BitOffset, StorageProviderType>;
+    constexpr size_t n = Operand::LimbCount;
+    const auto multiplicand = a.ToLimbs();
+    const auto multiplier = b.ToLimbs();
+    std::array<Limb, std::max(2 * n, Wide::LimbCount)> product{};
+    LimbMulFixed<n>(product.data(), multiplicand.data(), multiplier.data());
+    if (a.IsNegative()) {
+        LimbSubN(product.data() + n, product.data() + n, multiplier.data(), n);
+    }
+    if (b.IsNegative()) {
+        LimbSubN(product.data() + n, product.data() + n, multiplicand.data(), n);
+    }
+
+    Wide result;
+    result.FromLimbs(product.data());
+    return result;
 }
 
 #endif //ARBITRARYSIGNEDINT_UTILITY_OPS_INL
@@ -11,11 +11,16 @@
 #include <array>
 #include <iostream>
 #include <utility>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
 
+#include <concepts/ConstantTimeProvider.h>
 #include <concepts/StorageProvider.h>
+#include <core/limb/LimbEngine.h>
 
 // Forward declaration - don't include the header
-template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 class ArbitrarySignedInt;
 
 /**
@@ -76,12 +81,19 @@ public:
     template<size_t NewBitSize, size_t NewBitOffset, typename NewStorageProvider>
     explicit operator ArbitraryUnsignedInt<NewBitSize, NewBitOffset, NewStorageProvider>() const;
 
-    // Arithmetic operators
-    ArbitraryUnsignedInt operator+(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator-(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator*(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator/(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator%(const ArbitraryUnsignedInt& other);
+    // Arithmetic operators. The && overloads work in the storage of the operand that is going away
+    // instead of copying into a fresh result. That operand is left moved-from: on heap-backed storage
+    // it may only be assigned to or destroyed.
+    ArbitraryUnsignedInt operator+(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator+(const ArbitraryUnsignedInt& other) &&;
+    ArbitraryUnsignedInt operator+(ArbitraryUnsignedInt&& other) const&;
+    ArbitraryUnsignedInt operator+(ArbitraryUnsignedInt&& other) &&;
+    ArbitraryUnsignedInt operator-(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator-(const ArbitraryUnsignedInt& other) &&;
+    ArbitraryUnsignedInt operator*(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator*(const ArbitraryUnsignedInt& other) &&;
+    ArbitraryUnsignedInt operator/(const ArbitraryUnsignedInt& other) const;
+    ArbitraryUnsignedInt operator%(const ArbitraryUnsignedInt& other) const;
 
     // Assignment arithmetic operators
     ArbitraryUnsignedInt& operator+=(const ArbitraryUnsignedInt& other);
@@ -91,9 +103,12 @@ public:
     ArbitraryUnsignedInt& operator%=(const ArbitraryUnsignedInt& other);
 
     // Bitwise operators
-    ArbitraryUnsignedInt operator&(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator|(const ArbitraryUnsignedInt& other);
-    ArbitraryUnsignedInt operator^(const ArbitraryUnsignedInt& other);
+    ArbitraryUnsignedInt operator&(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator&(const ArbitraryUnsignedInt& other) &&;
+    ArbitraryUnsignedInt operator|(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator|(const ArbitraryUnsignedInt& other) &&;
+    ArbitraryUnsignedInt operator^(const ArbitraryUnsignedInt& other) const&;
+    ArbitraryUnsignedInt operator^(const ArbitraryUnsignedInt& other) &&;
     ArbitraryUnsignedInt operator~() const;
     ArbitraryUnsignedInt operator<<(size_t shift) const;
     ArbitraryUnsignedInt operator>>(size_t shift) const;
@@ -114,6 +129,9 @@ public:
     bool operator>=(const ArbitraryUnsignedInt& other) const;
     std::strong_ordering operator<=>(const ArbitraryUnsignedInt& other) const;
 
+    // Hash of the BitSize value bits only, read straight from storage; consistent with operator==
+    uint64_t Hash() const;
+
     // Increment/decrement
     ArbitraryUnsignedInt& operator++(); // prefix
     ArbitraryUnsignedInt operator++(int); // postfix
@@ -153,6 +171,11 @@ public:
         return BitOffset;
     }
 
+    // Set by a ConstantTimeProvider: comparisons, multiplication and powers take branch-free paths
+    // (addition, subtraction, shifts and bitwise operations always are). Division and string
+    // conversion stay variable-time.
+    static constexpr bool IsConstantTime = ConstantTimeProvider<StorageProviderType>;
+
     // Special values
     static ArbitraryUnsignedInt Max();
     static ArbitraryUnsignedInt Min(); // always 0 for unsigned
@@ -165,6 +188,12 @@ public:
         return storage_;
     }
 
+    // Limb view of the value, for internal use by the limb kernels
+    static constexpr size_t LimbCount = LimbCountForBits(BitSize);
+    using LimbArray = std::array<Limb, LimbCount>;
+    LimbArray ToLimbs() const; // bits above BitSize are zero
+    void FromLimbs(const Limb* limbs); // reads LimbCount limbs, keeps the low BitSize bits
+
     // Division operations with both quotient and remainder
     std::pair<ArbitraryUnsignedInt, ArbitraryUnsignedInt> DivRem(const ArbitraryUnsignedInt& other) const;
 
@@ -243,14 +272,38 @@ public:
 };
 
 // Additional utility functions
+// Binary GCD below LimbGcdLehmerThreshold limbs, Lehmer's algorithm from there on; gcd(0, 0) = 0.
+// The GCD family runs in variable time, constant-time providers included.
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
 Gcd(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b);
 
+// a / Gcd(a, b) * b, wrapping like operator*; zero when either operand is zero
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
 Lcm(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b);
 
+// {g, x, y} with a * x + b * y == g under wrapping arithmetic. x and y are two's complement:
+// |x| <= max(b / 2g, 1) and |y| <= max(a / 2g, 1), so the top bit is the sign
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+std::tuple<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> >
+ExtendedGcd(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b);
+
+// x in [0, modulus) with a * x == 1 mod modulus. Throws std::invalid_argument when gcd(a, modulus) != 1
+// and std::runtime_error on a zero modulus
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
+ModInverse(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus);
+
+// Constant-time selection: a when choice is true, else b, touching every limb of both either way
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
+ConditionalSelect(bool choice, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b);
+
+// Constant-time swap of a and b when choice is true
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+void ConditionalSwap(bool choice, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b);
+
 // Wide multiplication (returns result in double-wide type)
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize * 2, BitOffset, StorageProviderType>
@@ -285,6 +338,16 @@ using UInt128 = ArbitraryUnsignedInt<128, 0, StorageProvider>;
 template<typename StorageProvider>
 using UInt256 = ArbitraryUnsignedInt<256, 0, StorageProvider>;
 
+// Hash support so the type can key unordered containers. Only the value bits take part, so equal
+// values hash alike whatever their offset, storage provider or neighbouring bits. Lookups are not
+// heterogeneous: operator== only compares values of the same type.
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+struct std::hash<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> {
+    size_t operator()(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value) const noexcept {
+        return static_cast<size_t>(value.Hash());
+    }
+};
+
 #include <core/unsigned-int/impl/ArbitraryUnsignedIntImpl.h>
 
 #endif //ARBITRARYUNSIGNEDINT_H
@@ -0,0 +1,546 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYUNSIGNEDINTEXPRESSION_H
+#define ARBITRARYUNSIGNEDINTEXPRESSION_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <core/limb/LimbEngine.h>
+#include <core/unsigned-int/ArbitraryUnsignedInt.h>
+
+/**
+ * Opt-in expression templates for ArbitraryUnsignedInt.
+ *
+ * Wrapping an operand in Lazy() makes the operators build an expression tree instead of a value:
+ *
+ *     UInt4096 r = Lazy(a) * b + Lazy(c) * d - (Lazy(e) >> 3);
+ *
+ * Only subtrees that contain a Lazy() operand become expressions: in Lazy(a) * b + c * d the
+ * product c * d runs eagerly and builds a temporary like any plain operator. Within the tree,
+ * add, sub, shift, and, or, xor and not are evaluated together in one pass over the limbs when
+ * the tree is assigned, with no intermediate ArbitraryUnsignedInt. A product that is added to or
+ * subtracted from something is accumulated into that accumulator. Below the Karatsuba threshold
+ * this is a fused multiply-accumulate, one LimbAddMul1 / LimbSubMul1 pass per row. Above it, the
+ * product is computed in full with LimbMulLowFixed into a limb buffer, then added in a separate pass.
+ *
+ * Expressions hold references to their operands, so they must be evaluated before the operands go
+ * away; don't keep one in an auto variable. Plain operators on ArbitraryUnsignedInt are unaffected.
+ */
+
+template<typename Derived>
+struct UnsignedIntExpression;
+
+template<typename T>
+inline constexpr bool IsUnsignedIntExpression = std::is_base_of_v<UnsignedIntExpression<T>, T>;
+
+template<typename T>
+inline constexpr bool IsArbitraryUnsignedInt = false;
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+inline constexpr bool IsArbitraryUnsignedInt<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>> = true;
+
+template<typename Value>
+class UnsignedLeafExpr;
+
+// Expression node standing for T: leaves are wrapped, expressions are themselves
+template<typename T>
+using UnsignedExprOf = std::conditional_t<IsUnsignedIntExpression<T>, T, UnsignedLeafExpr<T>>;
+
+// At least one side is an expression, both sides are expressions or values, and the widths agree
+template<typename L, typename R>
+concept UnsignedIntExpressionOperands =
+        (IsUnsignedIntExpression<L> || IsUnsignedIntExpression<R>) &&
+        (IsUnsignedIntExpression<L> || IsArbitraryUnsignedInt<L>) &&
+        (IsUnsignedIntExpression<R> || IsArbitraryUnsignedInt<R>) &&
+        UnsignedExprOf<L>::ValueType::GetBitSize() == UnsignedExprOf<R>::ValueType::GetBitSize();
+
+/**
+ * @brief CRTP base of every expression node.
+ *
+ * A node exposes ValueType, a Cursor that yields the result limbs in ascending order through Next(),
+ * Begin() to start one, and Reads() to tell whether it reads a given storage object.
+ */
+template<typename Derived>
+struct UnsignedIntExpression {
+    // Write the value into target, which may be one of the operands
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    void EvaluateInto(ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& target) const;
+
+    auto Evaluate() const {
+        typename Derived::ValueType result;
+        EvaluateInto(result);
+        return result;
+    }
+
+    // Converts to any value of the same width
+    template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+    operator ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>() const {
+        ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
+        EvaluateInto(result);
+        return result;
+    }
+};
+
+// Runs a cursor to the end and collects the limbs
+template<typename Expr>
+typename Expr::ValueType::LimbArray UnsignedExprMaterialize(const Expr& expr) {
+    typename Expr::ValueType::LimbArray limbs;
+    auto cursor = expr.Begin();
+    for (Limb& limb : limbs) {
+        limb = cursor.Next();
+    }
+    return limbs;
+}
+
+template<typename Derived>
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType>
+void UnsignedIntExpression<Derived>::EvaluateInto(ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& target) const {
+    static_assert(BitSize == Derived::ValueType::GetBitSize(), "Expression width must match the target");
+    using Target = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    const Derived& self = static_cast<const Derived&>(*this);
+
+    if (self.Reads(&target.GetStorage())) {
+        // A left shift reads limbs below the one being written, so go through a buffer
+        const auto limbs = UnsignedExprMaterialize(self);
+        target.FromLimbs(limbs.data());
+        return;
+    }
+    auto cursor = self.Begin();
+    auto& storage = target.GetStorage();
+    for (size_t i = 0; i < Target::LimbCount; ++i) {
+        storage.StoreLimb(BitOffset + i * LimbBits, cursor.Next(), std::min(LimbBits, BitSize - i * LimbBits));
+    }
+}
+
+/**
+ * @brief Reads the limbs of an existing value straight from its storage.
+ */
+template<typename Value>
+class UnsignedLeafExpr : public UnsignedIntExpression<UnsignedLeafExpr<Value>> {
+    const Value& value_;
+
+public:
+    using ValueType = Value;
+
+    explicit UnsignedLeafExpr(const Value& value) : value_(value) {
+    }
+
+    struct Cursor {
+        const Value* value;
+        size_t index = 0;
+
+        Limb Next() {
+            if (index >= Value::LimbCount) {
+                return 0;
+            }
+            Limb limb = value->GetStorage().LoadLimb(Value::GetBitOffset() + index * LimbBits);
+            if (++index == Value::LimbCount) {
+                // Drop whatever shares the storage above the value
+                limb &= LimbMask(Value::GetBitSize() - (Value::LimbCount - 1) * LimbBits);
+            }
+            return limb;
+        }
+    };
+
+    Cursor Begin() const {
+        return Cursor{&value_};
+    }
+    bool Reads(const void* storage) const {
+        return &value_.GetStorage() == storage;
+    }
+};
+
+template<typename Expr>
+UnsignedExprOf<Expr> AsUnsignedExpr(const Expr& operand) {
+    if constexpr (IsUnsignedIntExpression<Expr>) {
+        return operand;
+    }
+    else {
+        return UnsignedLeafExpr<Expr>(operand);
+    }
+}
+
+/**
+ * @brief Limb-wise and, or or xor.
+ */
+template<typename L, typename R, typename Op>
+class UnsignedBitwiseExpr : public UnsignedIntExpression<UnsignedBitwiseExpr<L, R, Op>> {
+    L left_;
+    R right_;
+
+public:
+    using ValueType = typename L::ValueType;
+
+    UnsignedBitwiseExpr(const L& left, const R& right) : left_(left), right_(right) {
+    }
+
+    struct Cursor {
+        typename L::Cursor left;
+        typename R::Cursor right;
+
+        Limb Next() {
+            return Op{}(left.Next(), right.Next());
+        }
+    };
+
+    Cursor Begin() const {
+        return Cursor{left_.Begin(), right_.Begin()};
+    }
+    bool Reads(const void* storage) const {
+        return left_.Reads(storage) || right_.Reads(storage);
+    }
+};
+
+/**
+ * @brief Sum or difference, carrying from one limb to the next.
+ */
+template<typename L, typename R, bool Subtract>
+class UnsignedAddSubExpr : public UnsignedIntExpression<UnsignedAddSubExpr<L, R, Subtract>> {
+    L left_;
+    R right_;
+
+public:
+    using ValueType = typename L::ValueType;
+
+    UnsignedAddSubExpr(const L& left, const R& right) : left_(left), right_(right) {
+    }
+
+    struct Cursor {
+        typename L::Cursor left;
+        typename R::Cursor right;
+        bool carry = false;
+
+        Limb Next() {
+            if constexpr (Subtract) {
+                return LimbSubBorrow(left.Next(), right.Next(), carry);
+            }
+            else {
+                return LimbAddCarry(left.Next(), right.Next(), carry);
+            }
+        }
+    };
+
+    Cursor Begin() const {
+        return Cursor{left_.Begin(), right_.Begin()};
+    }
+    bool Reads(const void* storage) const {
+        return left_.Reads(storage) || right_.Reads(storage);
+    }
+};
+
+/**
+ * @brief Bitwise complement.
+ */
+template<typename E>
+class UnsignedNotExpr : public UnsignedIntExpression<UnsignedNotExpr<E>> {
+    E operand_;
+
+public:
+    using ValueType = typename E::ValueType;
+
+    explicit UnsignedNotExpr(const E& operand) : operand_(operand) {
+    }
+
+    struct Cursor {
+        typename E::Cursor operand;
+
+        Limb Next() {
+            return ~operand.Next();
+        }
+    };
+
+    Cursor Begin() const {
+        return Cursor{operand_.Begin()};
+    }
+    bool Reads(const void* storage) const {
+        return operand_.Reads(storage);
+    }
+};
+
+/**
+ * @brief Left shift; emits zero limbs first, then funnels the operand limbs in one behind.
+ */
+template<typename E>
+class UnsignedShiftLeftExpr : public UnsignedIntExpression<UnsignedShiftLeftExpr<E>> {
+    E operand_;
+    size_t shift_;
+
+public:
+    using ValueType = typename E::ValueType;
+
+    UnsignedShiftLeftExpr(const E& operand, size_t shift) : operand_(operand), shift_(shift) {
+    }
+
+    struct Cursor {
+        typename E::Cursor operand;
+        size_t zeroLimbs;
+        unsigned bitShift;
+        Limb previous = 0;
+
+        Limb Next() {
+            if (zeroLimbs > 0) {
+                --zeroLimbs;
+                return 0;
+            }
+            const Limb current = operand.Next();
+            const Limb result = bitShift == 0 ? current : (current << bitShift) | (previous >> (LimbBits - bitShift));
+            previous = current;
+            return result;
+        }
+    };
+
+    Cursor Begin() const {
+        const size_t zeroLimbs = std::min(shift_ / LimbBits, ValueType::LimbCount);
+        return Cursor{operand_.Begin(), zeroLimbs, static_cast<unsigned>(shift_ % LimbBits)};
+    }
+    bool Reads(const void* storage) const {
+        return operand_.Reads(storage);
+    }
+};
+
+/**
+ * @brief Logical right shift; skips the low operand limbs and reads one limb ahead.
+ */
+template<typename E>
+class UnsignedShiftRightExpr : public UnsignedIntExpression<UnsignedShiftRightExpr<E>> {
+    E operand_;
+    size_t shift_;
+
+public:
+    using ValueType = typename E::ValueType;
+
+    UnsignedShiftRightExpr(const E& operand, size_t shift) : operand_(operand), shift_(shift) {
+    }
+
+    struct Cursor {
+        typename E::Cursor operand;
+        unsigned bitShift;
+        size_t remaining = ValueType::LimbCount;
+        Limb current = 0;
+
+        Limb Pull() {
+            if (remaining == 0) {
+                return 0;
+            }
+            Limb limb = operand.Next();
+            if (--remaining == 0) {
+                // Bits above BitSize would otherwise be shifted into the value
+                limb &= LimbMask(ValueType::GetBitSize() - (ValueType::LimbCount - 1) * LimbBits);
+            }
+            return limb;
+        }
+
+        Limb Next() {
+            const Limb next = Pull();
+            const Limb result = bitShift == 0 ? current : (current >> bitShift) | (next << (LimbBits - bitShift));
+            current = next;
+            return result;
+        }
+    };
+
+    Cursor Begin() const {
+        Cursor cursor{operand_.Begin(), static_cast<unsigned>(shift_ % LimbBits)};
+        // The skipped limbs still have to be pulled so that carries below them are counted
+        for (size_t i = std::min(shift_ / LimbBits, ValueType::LimbCount); i > 0; --i) {
+            cursor.Pull();
+        }
+        cursor.current = cursor.Pull();
+        return cursor;
+    }
+    bool Reads(const void* storage) const {
+        return operand_.Reads(storage);
+    }
+};
+
+/**
+ * @brief Wrapping product. Needs every operand limb before the first result limb, so both operands
+ * are collected into limb arrays and multiplied with LimbMulLowFixed.
+ */
+template<typename L, typename R>
+class UnsignedMulExpr : public UnsignedIntExpression<UnsignedMulExpr<L, R>> {
+    L left_;
+    R right_;
+
+public:
+    using ValueType = typename L::ValueType;
+
+    UnsignedMulExpr(const L& left, const R& right) : left_(left), right_(right) {
+    }
+
+    const L& Left() const {
+        return left_;
+    }
+    const R& Right() const {
+        return right_;
+    }
+
+    struct Cursor {
+        typename ValueType::LimbArray product;
+        size_t index = 0;
+
+        Limb Next() {
+            return index < product.size() ? product[index++] : 0;
+        }
+    };
+
+    Cursor Begin() const {
+        const auto multiplicand = UnsignedExprMaterialize(left_);
+        const auto multiplier = UnsignedExprMaterialize(right_);
+        Cursor cursor;
+        LimbMulLowFixed<ValueType::LimbCount>(cursor.product.data(), multiplicand.data(), multiplier.data());
+        return cursor;
+    }
+    bool Reads(const void* storage) const {
+        return left_.Reads(storage) || right_.Reads(storage);
+    }
+};
+
+/**
+ * @brief accumulator +/- left * right, with the product rows added straight into the accumulator.
+ *
+ * Below the Karatsuba threshold each row is one LimbAddMul1 / LimbSubMul1 pass, so the product is
+ * never held on its own; above it the faster product is formed first and added in one pass.
+ */
+template<typename Acc, typename L, typename R, bool Subtract>
+class UnsignedMacExpr : public UnsignedIntExpression<UnsignedMacExpr<Acc, L, R, Subtract>> {
+    Acc accumulator_;
+    L left_;
+    R right_;
+
+public:
+    using ValueType = typename Acc::ValueType;
+
+    UnsignedMacExpr(const Acc& accumulator, const UnsignedMulExpr<L, R>& product)
+        : accumulator_(accumulator), left_(product.Left()), right_(product.Right()) {
+    }
+
+    struct Cursor {
+        typename ValueType::LimbArray result;
+        size_t index = 0;
+
+        Limb Next() {
+            return index < result.size() ? result[index++] : 0;
+        }
+    };
+
+    Cursor Begin() const {
+        constexpr size_t n = ValueType::LimbCount;
+        Cursor cursor{UnsignedExprMaterialize(accumulator_)};
+        const auto multiplicand = UnsignedExprMaterialize(left_);
+        const auto multiplier = UnsignedExprMaterialize(right_);
+        Limb* r = cursor.result.data();
+
+        if constexpr (n < LimbKaratsubaThreshold) {
+            // Only the low n limbs matter, so row j covers n - j limbs
+            for (size_t j = 0; j < n; ++j) {
+                if (multiplier[j] == 0) {
+                    continue;
+                }
+                if constexpr (Subtract) {
+                    LimbSubMul1(r + j, multiplicand.data(), n - j, multiplier[j]);
+                }
+                else {
+                    LimbAddMul1(r + j, multiplicand.data(), n - j, multiplier[j]);
+                }
+            }
+        }
+        else {
+            typename ValueType::LimbArray product;
+            LimbMulLowFixed<n>(product.data(), multiplicand.data(), multiplier.data());
+            if constexpr (Subtract) {
+                LimbSubN(r, r, product.data(), n);
+            }
+            else {
+                LimbAddN(r, r, product.data(), n);
+            }
+        }
+        return cursor;
+    }
+    bool Reads(const void* storage) const {
+        return accumulator_.Reads(storage) || left_.Reads(storage) || right_.Reads(storage);
+    }
+};
+
+// Entry point: start an expression from a value
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+UnsignedLeafExpr<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>>
+Lazy(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& value) {
+    return UnsignedLeafExpr<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>>(value);
+}
+
+// Operators; at least one operand has to be an expression already
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedAddSubExpr<UnsignedExprOf<L>, UnsignedExprOf<R>, false> operator+(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedAddSubExpr<UnsignedExprOf<L>, UnsignedExprOf<R>, true> operator-(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedMulExpr<UnsignedExprOf<L>, UnsignedExprOf<R>> operator*(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedBitwiseExpr<UnsignedExprOf<L>, UnsignedExprOf<R>, std::bit_and<Limb>> operator&(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedBitwiseExpr<UnsignedExprOf<L>, UnsignedExprOf<R>, std::bit_or<Limb>> operator|(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename L, typename R> requires UnsignedIntExpressionOperands<L, R>
+UnsignedBitwiseExpr<UnsignedExprOf<L>, UnsignedExprOf<R>, std::bit_xor<Limb>> operator^(const L& left, const R& right) {
+    return {AsUnsignedExpr(left), AsUnsignedExpr(right)};
+}
+
+template<typename E> requires IsUnsignedIntExpression<E>
+UnsignedNotExpr<E> operator~(const E& operand) {
+    return UnsignedNotExpr<E>(operand);
+}
+
+template<typename E> requires IsUnsignedIntExpression<E>
+UnsignedShiftLeftExpr<E> operator<<(const E& operand, size_t shift) {
+    return {operand, shift};
+}
+
+template<typename E> requires IsUnsignedIntExpression<E>
+UnsignedShiftRightExpr<E> operator>>(const E& operand, size_t shift) {
+    return {operand, shift};
+}
+
+// A product added to or subtracted from anything folds into a multiply-accumulate
+
+template<typename L, typename A, typename B> requires UnsignedIntExpressionOperands<L, UnsignedMulExpr<A, B>>
+UnsignedMacExpr<UnsignedExprOf<L>, A, B, false> operator+(const L& accumulator, const UnsignedMulExpr<A, B>& product) {
+    return {AsUnsignedExpr(accumulator), product};
+}
+
+template<typename A, typename B, typename R> requires UnsignedIntExpressionOperands<UnsignedMulExpr<A, B>, R>
+UnsignedMacExpr<UnsignedExprOf<R>, A, B, false> operator+(const UnsignedMulExpr<A, B>& product, const R& accumulator) {
+    return {AsUnsignedExpr(accumulator), product};
+}
+
+template<typename A, typename B, typename C, typename D> requires UnsignedIntExpressionOperands<UnsignedMulExpr<A, B>, UnsignedMulExpr<C, D>>
+UnsignedMacExpr<UnsignedMulExpr<A, B>, C, D, false> operator+(const UnsignedMulExpr<A, B>& left, const UnsignedMulExpr<C, D>& right) {
+    return {left, right};
+}
+
+template<typename L, typename A, typename B> requires UnsignedIntExpressionOperands<L, UnsignedMulExpr<A, B>>
+UnsignedMacExpr<UnsignedExprOf<L>, A, B, true> operator-(const L& accumulator, const UnsignedMulExpr<A, B>& product) {
+    return {AsUnsignedExpr(accumulator), product};
+}
+
+#endif //ARBITRARYUNSIGNEDINTEXPRESSION_H
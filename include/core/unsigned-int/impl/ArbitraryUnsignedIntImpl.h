@@ -13,8 +13,10 @@
 #include <core/unsigned-int/impl/byte_conversion.inl>
 #include <core/unsigned-int/impl/checked_ops.inl>
 #include <core/unsigned-int/impl/comparison.inl>
+#include <core/unsigned-int/impl/constant_time.inl>
 #include <core/unsigned-int/impl/constructor.inl>
 #include <core/unsigned-int/impl/conversions.inl>
+#include <core/unsigned-int/impl/limb_access.inl>
 #include <core/unsigned-int/impl/overflowing_ops.inl>
 #include <core/unsigned-int/impl/saturating_ops.inl>
 #include <core/unsigned-int/impl/static_properties.inl>
@@ -6,72 +6,85 @@
 #define ARBITRARYUNSIGNEDINT_BITWISE_INL
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
-ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator&(const ArbitraryUnsignedInt& other) {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = storage_;
-    result.storage_.ByteAnd(other.storage_);
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator&(const ArbitraryUnsignedInt& other) const& {
+    ArbitraryUnsignedInt result(*this);
+    result.storage_.BitwiseAnd(other.storage_);
     return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
-ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator|(const ArbitraryUnsignedInt& other) {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = storage_;
-    result.storage_.ByteOr(other.storage_);
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator&(const ArbitraryUnsignedInt& other) && {
+    storage_.BitwiseAnd(other.storage_);
+    return std::move(*this);
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator|(const ArbitraryUnsignedInt& other) const& {
+    ArbitraryUnsignedInt result(*this);
+    result.storage_.BitwiseOr(other.storage_);
     return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
-ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator^(const ArbitraryUnsignedInt& other) {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = storage_;
-    result.storage_.ByteXor(other.storage_);
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator|(const ArbitraryUnsignedInt& other) && {
+    storage_.BitwiseOr(other.storage_);
+    return std::move(*this);
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator^(const ArbitraryUnsignedInt& other) const& {
+    ArbitraryUnsignedInt result(*this);
+    result.storage_.BitwiseXor(other.storage_);
     return result;
 }
 
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator^(const ArbitraryUnsignedInt& other) && {
+    storage_.BitwiseXor(other.storage_);
+    return std::move(*this);
+}
+
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator<<(size_t shift) const {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = this->storage_;
-    result.storage_.ShiftLeft(shift);
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result(*this);
+    result.storage_.ShiftRangeLeft(BitOffset, BitSize, shift);
     return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator>>(size_t shift) const {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = this->storage_;
-    result.storage_.ShiftRight(shift);
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result(*this);
+    result.storage_.ShiftRangeRight(BitOffset, BitSize, shift);
     return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator&=(const ArbitraryUnsignedInt& other) {
-    this->storage_.BitwiseAnd(other->storage_);
+    this->storage_.BitwiseAnd(other.storage_);
     return *this;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator|=(const ArbitraryUnsignedInt& other) {
-    this->storage_.BitwiseOr(other->storage_);
+    this->storage_.BitwiseOr(other.storage_);
     return *this;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator^=(const ArbitraryUnsignedInt& other) {
-    this->storage_.BitwiseXor(other->storage_);
+    this->storage_.BitwiseXor(other.storage_);
     return *this;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator<<=(size_t shift) {
-    this->storage_.ShiftLeft(shift);
+    this->storage_.ShiftRangeLeft(BitOffset, BitSize, shift);
     return *this;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator>>=(size_t shift) {
-    this->storage_.ShiftRight(shift);
+    this->storage_.ShiftRangeRight(BitOffset, BitSize, shift);
     return *this;
 }
 
@@ -7,13 +7,36 @@
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator==(const ArbitraryUnsignedInt& other) const {
-    // Compare only the actual bits that matter
-    for (size_t i = 0; i < BitSize; ++i) {
-        if (GetBit(BitOffset + i) != other.GetBit(BitOffset + i)) {
+    if constexpr (IsConstantTime) {
+        // Every limb is read whatever the first difference is
+        const LimbArray lhs = ToLimbs();
+        const LimbArray rhs = other.ToLimbs();
+        return LimbCtEqual(lhs.data(), rhs.data(), LimbCount) != 0;
+    }
+    else if constexpr (BitOffset % 8 == 0) {
+        // Byte-aligned: memcmp over the whole bytes, then the masked tail byte
+        constexpr size_t fullBytes = BitSize / 8;
+        const uint8_t* lhs = storage_.Data() + BitOffset / 8;
+        const uint8_t* rhs = other.storage_.Data() + BitOffset / 8;
+        if (std::memcmp(lhs, rhs, fullBytes) != 0) {
             return false;
         }
+        if constexpr (BitSize % 8 != 0) {
+            constexpr uint8_t tailMask = (1u << (BitSize % 8)) - 1;
+            return ((lhs[fullBytes] ^ rhs[fullBytes]) & tailMask) == 0;
+        }
+        return true;
+    }
+    else {
+        // Limb-wise, masking the bits that share the storage above the value
+        for (size_t i = 0; i < LimbCount; ++i) {
+            const Limb difference = storage_.LoadLimb(BitOffset + i * LimbBits) ^ other.storage_.LoadLimb(BitOffset + i * LimbBits);
+            if ((difference & LimbMask(BitSize - i * LimbBits)) != 0) {
+                return false;
+            }
+        }
+        return true;
     }
-    return true;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -23,43 +46,50 @@ bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator!=(c
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator<(const ArbitraryUnsignedInt& other) const {
-    for (size_t i = BitSize; i > 0; --i) {
-        bool thisBit = GetBit(BitOffset + i - 1);
-        bool otherBit = other.GetBit(BitOffset + i - 1);
-
-        if (thisBit != otherBit) {
-            return thisBit < otherBit; // 0 < 1 is true
-        }
-    }
-    return false; // Equal numbers
+    return (*this <=> other) < 0;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator<=(const ArbitraryUnsignedInt& other) const {
-    return (*this < other) || (*this == other);
+    return (*this <=> other) <= 0;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator>(const ArbitraryUnsignedInt& other) const {
-    return !(*this <= other);
+    return (*this <=> other) > 0;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator>=(const ArbitraryUnsignedInt& other) const {
-    return !(*this < other);
+    return (*this <=> other) >= 0;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::strong_ordering ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator<=>(const ArbitraryUnsignedInt& other) const {
-    for (size_t i = BitSize; i > 0; --i) {
-        bool thisBit = GetBit(BitOffset + i - 1);
-        bool otherBit = other.GetBit(BitOffset + i - 1);
-
-        if (thisBit != otherBit) {
-            return thisBit <=> otherBit; // 0 < 1 is true
+    if constexpr (IsConstantTime) {
+        // Full borrow chain instead of stopping at the first differing limb
+        const LimbArray lhs = ToLimbs();
+        const LimbArray rhs = other.ToLimbs();
+        return LimbCtCompare(lhs.data(), rhs.data(), LimbCount) <=> 0;
+    }
+    // Most significant limb first, masking the bits that share the storage above the value
+    for (size_t i = LimbCount; i-- > 0;) {
+        const Limb mask = LimbMask(BitSize - i * LimbBits);
+        const Limb lhs = storage_.LoadLimb(BitOffset + i * LimbBits) & mask;
+        const Limb rhs = other.storage_.LoadLimb(BitOffset + i * LimbBits) & mask;
+        if (lhs != rhs) {
+            return lhs <=> rhs;
         }
     }
-    return std::strong_ordering::equal; // Equal numbers
+    return std::strong_ordering::equal;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+uint64_t ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::Hash() const {
+    // Same limbs operator== compares, with the bits above the value masked off
+    return LimbHashLimbs([this](size_t i) {
+        return storage_.LoadLimb(BitOffset + i * LimbBits) & LimbMask(BitSize - i * LimbBits);
+    }, LimbCount);
 }
 
 #endif //ARBITRARYUNSIGNEDINT_COMPARISON_INL
@@ -0,0 +1,32 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYUNSIGNEDINT_CONSTANT_TIME_INL
+#define ARBITRARYUNSIGNEDINT_CONSTANT_TIME_INL
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
+ConditionalSelect(bool choice, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
+    using UInt = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    const typename UInt::LimbArray lhs = a.ToLimbs();
+    const typename UInt::LimbArray rhs = b.ToLimbs();
+    typename UInt::LimbArray selected;
+    LimbCtSelect(selected.data(), lhs.data(), rhs.data(), UInt::LimbCount, LimbCtMask(choice));
+
+    UInt result;
+    result.FromLimbs(selected.data());
+    return result;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+void ConditionalSwap(bool choice, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
+    using UInt = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    typename UInt::LimbArray lhs = a.ToLimbs();
+    typename UInt::LimbArray rhs = b.ToLimbs();
+    LimbCtSwap(lhs.data(), rhs.data(), UInt::LimbCount, LimbCtMask(choice));
+    a.FromLimbs(lhs.data());
+    b.FromLimbs(rhs.data());
+}
+
+#endif //ARBITRARYUNSIGNEDINT_CONSTANT_TIME_INL
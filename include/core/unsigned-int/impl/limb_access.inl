@@ -0,0 +1,26 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef ARBITRARYUNSIGNEDINT_LIMB_ACCESS_INL
+#define ARBITRARYUNSIGNEDINT_LIMB_ACCESS_INL
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+typename ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::LimbArray ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::ToLimbs() const {
+    LimbArray limbs;
+    for (size_t i = 0; i < LimbCount; ++i) {
+        limbs[i] = storage_.LoadLimb(BitOffset + i * LimbBits);
+    }
+    // Drop whatever shares the storage above the value
+    limbs[LimbCount - 1] &= LimbMask(BitSize - (LimbCount - 1) * LimbBits);
+    return limbs;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+void ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::FromLimbs(const Limb* limbs) {
+    for (size_t i = 0; i < LimbCount; ++i) {
+        storage_.StoreLimb(BitOffset + i * LimbBits, limbs[i], std::min(LimbBits, BitSize - i * LimbBits));
+    }
+}
+
+#endif //ARBITRARYUNSIGNEDINT_LIMB_ACCESS_INL
@@ -20,8 +20,15 @@ ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedI
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::IsZero() const {
-    for (size_t i = 0; i < BitSize; ++i) {
-        if (this->GetBit(i)) {
+    if constexpr (IsConstantTime) {
+        Limb bits = 0;
+        for (size_t i = 0; i < LimbCount; ++i) {
+            bits |= storage_.LoadLimb(BitOffset + i * LimbBits) & LimbMask(BitSize - i * LimbBits);
+        }
+        return LimbCtIsNonZero(bits) == 0;
+    }
+    for (size_t i = 0; i < LimbCount; ++i) {
+        if ((storage_.LoadLimb(BitOffset + i * LimbBits) & LimbMask(BitSize - i * LimbBits)) != 0) {
             return false;
         }
     }
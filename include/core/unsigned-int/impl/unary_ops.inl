@@ -33,8 +33,12 @@ ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedI
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::operator~() const {
-    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result;
-    result.storage_ = storage_.ByteNot();
+    // Only the value bits are flipped, so the bits above BitSize stay zero
+    ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> result(*this);
+    for (size_t i = 0; i < LimbCount; ++i) {
+        const size_t bitIndex = BitOffset + i * LimbBits;
+        result.storage_.StoreLimb(bitIndex, ~storage_.LoadLimb(bitIndex), std::min(LimbBits, BitSize - i * LimbBits));
+    }
     return result;
 }
 
@@ -8,75 +8,25 @@
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 std::pair<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> >
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::DivRem(const ArbitraryUnsignedInt& other) const {
+    const LimbArray dividend = ToLimbs();
+    const LimbArray divisor = other.ToLimbs();
+
     // Division by zero check
-    if (other.IsZero()) {
+    if (std::all_of(divisor.begin(), divisor.end(), [](Limb limb) { return limb == 0; })) {
         throw std::runtime_error("Division by zero");
     }
 
-    ArbitraryUnsignedInt quotient;
-
-    // Handle zero dividend
-    if (this->IsZero()) {
-        return { quotient, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>() };
-    }
-
-    // Handle division by 1 (all zeros except LSB)
-    ArbitraryUnsignedInt one;
-    one.storage_.ClearAllBits();
-    one.SetBit(0);
-    if (other == one) {
-        return { *this, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>() };
-    }
-
-    // Long division algorithm using bit operations
-    ArbitraryUnsignedInt dividend = *this;
-    ArbitraryUnsignedInt divisor = other;
-
-    // Find the position of the most significant bit in divisor
-    size_t divisor_msb = 0;
-    for (size_t i = BitSize; i > 0; --i) {
-        if (divisor.GetBit(i - 1)) {
-            divisor_msb = i - 1;
-            break;
-        }
-    }
-
-    // Find the position of the most significant bit in dividend
-    size_t dividend_msb = 0;
-    for (size_t i = BitSize; i > 0; --i) {
-        if (dividend.GetBit(i - 1)) {
-            dividend_msb = i - 1;
-            break;
-        }
-    }
-
-    if (dividend_msb < divisor_msb) {
-        return { quotient, dividend }; // Result is 0
-    }
-
-    // Shift divisor to align with dividend's MSB
-    size_t shift = dividend_msb - divisor_msb;
-    divisor.storage_.ShiftLeft(shift);
-
-    for (size_t i = 0; i <= shift; ++i) {
-        // Compare dividend with shifted divisor
-        // If dividend is greater than or equal to divisor
-        if (dividend >= divisor) {
-            // Subtract divisor from dividend using OffsetSubWithBorrow
-            auto sub_result = dividend.GetStorage().OffsetSubWithBorrow(divisor.GetStorage(), divisor.GetBitOffset(), BitSize, dividend.GetBitOffset(), false);
-            dividend.GetStorage() = sub_result.first;
-
-            // Set corresponding bit in quotient
-            quotient.SetBit(shift - i);
-        }
+    // Knuth's Algorithm D, or a single-limb pass when the divisor fits in 64 bits
+    LimbArray quotientLimbs;
+    LimbArray remainderLimbs;
+    std::array<Limb, LimbDivRemScratchSize(LimbCount, LimbCount)> scratch;
+    LimbDivRem(quotientLimbs.data(), remainderLimbs.data(), dividend.data(), LimbCount, divisor.data(), LimbCount, scratch.data());
 
-        // Shift divisor right for next iteration
-        if (i < shift) {
-            divisor.storage_.ShiftRight(1);
-        }
-    }
-
-    return { quotient, dividend };
+    ArbitraryUnsignedInt quotient;
+    ArbitraryUnsignedInt remainder;
+    quotient.FromLimbs(quotientLimbs.data());
+    remainder.FromLimbs(remainderLimbs.data());
+    return { quotient, remainder };
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
@@ -84,12 +34,21 @@ ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedI
     // Implemented by Exponentiation by Squaring
     ArbitraryUnsignedInt result = 1;
     ArbitraryUnsignedInt base = *this;
-    while (!exp.IsZero()) {
-        if (exp.GetBit(0)) {
-            result *= base;
+    if constexpr (IsConstantTime) {
+        // Every exponent bit costs one multiply and one square, and the product is masked in
+        for (size_t i = 0; i < BitSize; ++i) {
+            result = ConditionalSelect(exp.GetBit(i), result * base, result);
+            base *= base;
+        }
+    }
+    else {
+        while (!exp.IsZero()) {
+            if (exp.GetBit(0)) {
+                result *= base;
+            }
+            base *= base;
+            exp.storage_.ShiftRight(1);
         }
-        base *= base;
-        exp.storage_.ShiftRight(1);
     }
     return result;
 }
@@ -98,12 +57,20 @@ template<size_t BitSize, size_t BitOffset, typename StorageProviderType> require
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::Pow(size_t exp) const {
     ArbitraryUnsignedInt result = 1;
     ArbitraryUnsignedInt base = *this;
-    while (exp > 0) {
-        if (exp & 1) {
-            result *= base;
+    if constexpr (IsConstantTime) {
+        for (size_t i = 0; i < sizeof(exp) * 8; ++i) {
+            result = ConditionalSelect(((exp >> i) & 1) != 0, result * base, result);
+            base *= base;
+        }
+    }
+    else {
+        while (exp > 0) {
+            if (exp & 1) {
+                result *= base;
+            }
+            base *= base;
+            exp >>= 1;
         }
-        base *= base;
-        exp >>= 1;
     }
     return result;
 }
@@ -147,55 +114,81 @@ bool ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>::IsPowerOfTwo
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> Gcd(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
-    // This code is based on euclid's algorithm, which states 
-    // WLOG, gcd(a, b) = gcd(a % b, b)
-    // So, we can just call the recursive function.
-    if (a < b) {
-        return Gcd(b, a);
-    }
-    return b.IsZero() ?
-               a :
-               Gcd(b, a % b);
+    using Operand = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    typename Operand::LimbArray left = a.ToLimbs();
+    typename Operand::LimbArray right = b.ToLimbs();
+    std::array<Limb, LimbGcdScratchSize(Operand::LimbCount)> scratch;
+    LimbGcd(left.data(), left.data(), right.data(), Operand::LimbCount, scratch.data());
+
+    Operand result;
+    result.FromLimbs(left.data());
+    return result;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> Lcm(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
-    return a * b / Gcd(a, b);
+    if (a.IsZero() || b.IsZero()) {
+        return 0;
+    }
+    // Dividing first keeps the quotient exact; only the final product can wrap
+    return a / Gcd(a, b) * b;
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+std::tuple<ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>, ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType> >
+ExtendedGcd(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
+    using Operand = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    const typename Operand::LimbArray left = a.ToLimbs();
+    const typename Operand::LimbArray right = b.ToLimbs();
+    typename Operand::LimbArray gcdLimbs;
+    typename Operand::LimbArray xLimbs;
+    typename Operand::LimbArray yLimbs;
+    std::array<Limb, LimbGcdExtendedScratchSize(Operand::LimbCount)> scratch;
+    LimbGcdExtended(gcdLimbs.data(), xLimbs.data(), yLimbs.data(), left.data(), right.data(), Operand::LimbCount, scratch.data());
+
+    Operand g;
+    Operand x;
+    Operand y;
+    g.FromLimbs(gcdLimbs.data());
+    x.FromLimbs(xLimbs.data());
+    y.FromLimbs(yLimbs.data());
+    return { g, x, y };
+}
+
+template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
+ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>
+ModInverse(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& modulus) {
+    using Operand = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    const typename Operand::LimbArray reduced = (a % modulus).ToLimbs();
+    const typename Operand::LimbArray modulusLimbs = modulus.ToLimbs();
+    typename Operand::LimbArray gcdLimbs;
+    typename Operand::LimbArray xLimbs;
+    typename Operand::LimbArray yLimbs;
+    std::array<Limb, LimbGcdExtendedScratchSize(Operand::LimbCount)> scratch;
+    LimbGcdExtended(gcdLimbs.data(), xLimbs.data(), yLimbs.data(), reduced.data(), modulusLimbs.data(), Operand::LimbCount, scratch.data());
+
+    if (gcdLimbs[0] != 1 || std::any_of(gcdLimbs.begin() + 1, gcdLimbs.end(), [](Limb limb) { return limb != 0; })) {
+        throw std::invalid_argument("Value is not invertible modulo the given modulus");
+    }
+    // |x| <= modulus / 2, so a negative x is brought into range by adding the modulus once
+    if ((xLimbs[Operand::LimbCount - 1] >> (LimbBits - 1)) != 0) {
+        LimbAddN(xLimbs.data(), xLimbs.data(), modulusLimbs.data(), Operand::LimbCount);
+    }
+    Operand inverse;
+    inverse.FromLimbs(xLimbs.data());
+    return inverse;
 }
 
 template<size_t BitSize, size_t BitOffset, typename StorageProviderType> requires StorageProvider<StorageProviderType, ((BitSize + BitOffset + 7) >> 3)>
 ArbitraryUnsignedInt<BitSize * 2, BitOffset, StorageProviderType> WideningMul(const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& a, const ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>& b) {
-    ArbitraryUnsignedInt<BitSize * 2, BitOffset, StorageProviderType> result; // Initialize to zero
-
-    // Iterate through each bit of 'b'
-    for (size_t i = 0; i < BitSize; ++i) {
-        if (b.GetBit(i)) {
-            // If the i-th bit of 'b' is set
-            bool current_carry = false;
-            // Add 'a' shifted left by 'i' positions to the result
-            // The source is a.storage_, starting from a.BitOffset, with BitSize bits
-            // The destination is result.storage_, starting from result.BitOffset + i
-            auto add_result = result.GetStorage().OffsetAddWithCarry(a.GetStorage(), a.GetBitOffset(), BitSize, result.GetBitOffset() + i, current_carry);
-            result.GetStorage() = add_result.first;
-            current_carry = add_result.second;
-
-            // Propagate remaining carry
-            for (size_t k = BitSize; k < BitSize * 2; ++k) {
-                size_t result_bit_index = i + k;
-                if (result_bit_index < BitSize * 2) {
-                    if (current_carry) {
-                        bool bit_result = result.GetBit(result_bit_index);
-                        bool sum_bit = bit_result ^ current_carry;
-                        current_carry = bit_result && current_carry;
-                        result.SetBit(result_bit_index, sum_bit);
-                    }
-                    else {
-                        break; // No more carry
-                    }
-                }
-            }
-        }
-    }
+    using Operand = ArbitraryUnsignedInt<BitSize, BitOffset, StorageProviderType>;
+    const typename Operand::LimbArray multiplicand = a.ToLimbs();
+    const typename Operand::LimbArray multiplier = b.ToLimbs();
+    std::array<Limb, 2 * Operand::LimbCount> product;
+    LimbMulFixed<Operand::LimbCount>(product.data(), multiplicand.data(), multiplier.data());
+
+    ArbitraryUnsignedInt<BitSize * 2, BitOffset, StorageProviderType> result;
+    result.FromLimbs(product.data());
     return result;
 }
 
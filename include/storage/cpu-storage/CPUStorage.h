@@ -11,19 +11,24 @@
 #include <numeric>
 #include <cstring>
 
+#include <core/limb/LimbEngine.h>
+#include <storage/cpu-storage/CPUStorageLayout.h>
+
 // Forward declaration of CPUStorageProvider
 class CPUStorageProvider;
+class CPULimbStorageProvider;
 
-template<size_t size>
+template<size_t size, typename Layout = CPUByteLayout>
 class CPUStorage {
 public:
-    std::array<uint8_t, size> data_;
+    typename Layout::template Buffer<size> data_;
     static constexpr size_t totalBits = size << 3;
+    static constexpr size_t dataAlignment = Layout::alignment;
 
     CPUStorage();
 
     // Implementations for Storage concept
-    std::unique_ptr<CPUStorage<size> > Clone() const;
+    std::unique_ptr<CPUStorage<size, Layout> > Clone() const;
 
     // BitAccessible implementations
     bool GetBit(const size_t bitIndex) const;
@@ -56,22 +61,27 @@ public:
     // BitCopyable implementations
     void CopyBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart);
     void MoveBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart);
-    template<size_t OtherSize>
-    void CopyBitsFrom(const CPUStorage<OtherSize>& source, size_t srcStart, size_t bitCount, size_t dstStart);
-    template<size_t OtherSize>
-    void CopyBitsTo(CPUStorage<OtherSize>& destination, size_t srcStart, size_t bitCount, size_t dstStart) const;
+    template<size_t OtherSize, typename OtherLayout>
+    void CopyBitsFrom(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t bitCount, size_t dstStart);
+    template<size_t OtherSize, typename OtherLayout>
+    void CopyBitsTo(CPUStorage<OtherSize, OtherLayout>& destination, size_t srcStart, size_t bitCount, size_t dstStart) const;
     void SetBitRange(size_t start, size_t count);
     void ClearBitRange(size_t start, size_t count);
     void FlipBitRange(size_t start, size_t count);
-    template<size_t OtherSize>
-    bool CanCopyBits(const CPUStorage<OtherSize>& source, size_t srcStart, size_t bitCount, size_t dstStart) const;
+    template<size_t OtherSize, typename OtherLayout>
+    bool CanCopyBits(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t bitCount, size_t dstStart) const;
 
     // BitManipulable implementations
     void ShiftLeft(size_t positions);
     void ShiftRight(size_t positions);
     void RotateLeft(size_t positions);
     void RotateRight(size_t positions);
+    void ShiftRangeLeft(size_t start, size_t count, size_t positions);
+    void ShiftRangeRight(size_t start, size_t count, size_t positions);
+    void RotateRangeLeft(size_t start, size_t count, size_t positions);
+    void RotateRangeRight(size_t start, size_t count, size_t positions);
     void ReverseBits();
+    void ReverseBitRange(size_t start, size_t count);
     void ReverseBytes();
     void BitwiseAnd(const CPUStorage& other);
     void BitwiseOr(const CPUStorage& other);
@@ -81,16 +91,16 @@ public:
     void Decrement();
     void OffsetAdd(size_t offset, size_t bitWidth, size_t value);
     void OffsetSub(size_t offset, size_t bitWidth, size_t value);
-    template<size_t OtherSize>
-    void OffsetAdd(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart);
-    template<size_t OtherSize>
-    void OffsetSub(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart);
-    std::pair<CPUStorage<size>, bool> OffsetAddWithCarry(size_t offset, size_t bitWidth, size_t value, bool initialCarry);
-    std::pair<CPUStorage<size>, bool> OffsetSubWithBorrow(size_t offset, size_t bitWidth, size_t value, bool initialBorrow);
-    template<size_t OtherSize>
-    std::pair<CPUStorage<size>, bool> OffsetAddWithCarry(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialCarry);
-    template<size_t OtherSize>
-    std::pair<CPUStorage<size>, bool> OffsetSubWithBorrow(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialBorrow);
+    template<size_t OtherSize, typename OtherLayout>
+    void OffsetAdd(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart);
+    template<size_t OtherSize, typename OtherLayout>
+    void OffsetSub(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart);
+    std::pair<CPUStorage<size, Layout>, bool> OffsetAddWithCarry(size_t offset, size_t bitWidth, size_t value, bool initialCarry);
+    std::pair<CPUStorage<size, Layout>, bool> OffsetSubWithBorrow(size_t offset, size_t bitWidth, size_t value, bool initialBorrow);
+    template<size_t OtherSize, typename OtherLayout>
+    std::pair<CPUStorage<size, Layout>, bool> OffsetAddWithCarry(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialCarry);
+    template<size_t OtherSize, typename OtherLayout>
+    std::pair<CPUStorage<size, Layout>, bool> OffsetSubWithBorrow(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialBorrow);
 
     // ByteAccessible implementations
     uint8_t& operator[](size_t index);
@@ -114,16 +124,16 @@ public:
     // ByteCopyable implementations
     void CopyBytesInternal(size_t srcStart, size_t count, size_t dst);
     void MoveBytesInternal(size_t srcStart, size_t count, size_t dst);
-    template<size_t OtherSize>
-    void CopyBytesFrom(const CPUStorage<OtherSize>& source, size_t srcStart, size_t count, size_t dst);
-    template<size_t OtherSize>
-    void CopyBytesTo(CPUStorage<OtherSize>& destination, size_t srcStart, size_t count, size_t dst) const;
+    template<size_t OtherSize, typename OtherLayout>
+    void CopyBytesFrom(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t count, size_t dst);
+    template<size_t OtherSize, typename OtherLayout>
+    void CopyBytesTo(CPUStorage<OtherSize, OtherLayout>& destination, size_t srcStart, size_t count, size_t dst) const;
     void CopyFromBytes(const uint8_t* src, size_t srcByteSize, size_t srcOffsetBytes, size_t dstOffsetBytes, size_t countBytes);
     void CopyToBytes(uint8_t* dst, size_t dstByteSize, size_t srcOffsetBytes, size_t dstOffsetBytes, size_t countBytes) const;
     void CopyFromSpan(std::span<const uint8_t> src_span, size_t dst);
     void CopyToSpan(std::span<uint8_t> dst_span, size_t start) const;
-    template<size_t OtherSize>
-    bool CanCopyBytes(const CPUStorage<OtherSize>& source, size_t srcStart, size_t count, size_t dst) const;
+    template<size_t OtherSize, typename OtherLayout>
+    bool CanCopyBytes(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t count, size_t dst) const;
     void MoveBytes(size_t srcOffsetBytes, size_t dstOffsetBytes, size_t countBytes);
     bool CanCopyBytes(size_t srcOffsetBytes, size_t dstOffsetBytes, size_t countBytes) const;
 
@@ -141,16 +151,26 @@ public:
     void BytewiseOr(const CPUStorage& other);
     void BytewiseXor(const CPUStorage& other);
     void BytewiseNot();
+
+    // Limb access: 64-bit words at arbitrary bit positions
+    Limb LoadLimb(size_t bitIndex) const;
+    void StoreLimb(size_t bitIndex, Limb value, size_t bitCount = LimbBits);
+
+private:
+    template<typename SourceLimbs>
+    bool AddLimbRange(size_t dstStart, size_t bitWidth, SourceLimbs&& sourceLimbs, bool carry);
+    template<typename SourceLimbs>
+    bool SubLimbRange(size_t dstStart, size_t bitWidth, SourceLimbs&& sourceLimbs, bool borrow);
 };
 
-template<size_t size>
-CPUStorage<size>::CPUStorage() {
+template<size_t size, typename Layout>
+CPUStorage<size, Layout>::CPUStorage() {
     data_.fill(0);
 }
 
-template<size_t size>
-std::unique_ptr<CPUStorage<size> > CPUStorage<size>::Clone() const {
-    return std::make_unique<CPUStorage<size> >(*this);
+template<size_t size, typename Layout>
+std::unique_ptr<CPUStorage<size, Layout> > CPUStorage<size, Layout>::Clone() const {
+    return std::make_unique<CPUStorage<size, Layout> >(*this);
 }
 
 #include <storage/cpu-storage/impl/CPUStorageImpl.h>
@@ -166,4 +186,44 @@ public:
     }
 };
 
+// Provides CPUStorage backed by 64-byte aligned limbs (see CPULimbLayout)
+class CPULimbStorageProvider {
+public:
+    template<size_t size>
+    using StorageType = CPUStorage<size, CPULimbLayout>;
+
+    template<size_t size>
+    static CPUStorage<size, CPULimbLayout> create() {
+        return CPUStorage<size, CPULimbLayout>();
+    }
+};
+
+// Provides limb-aligned CPUStorage and opts the number types into their constant-time paths:
+// comparisons, multiplication and powers then never branch on or index by the stored values
+class CPUConstantTimeStorageProvider {
+public:
+    static constexpr bool constantTime = true;
+
+    template<size_t size>
+    using StorageType = CPUStorage<size, CPULimbLayout>;
+
+    template<size_t size>
+    static CPUStorage<size, CPULimbLayout> create() {
+        return CPUStorage<size, CPULimbLayout>();
+    }
+};
+
+// Provides CPUStorage whose limbs come from an allocator instead of the stack (see CPUHeapLayout)
+template<typename Allocator = std::pmr::polymorphic_allocator<Limb>>
+class CPUHeapStorageProvider {
+public:
+    template<size_t size>
+    using StorageType = CPUStorage<size, CPUHeapLayout<Allocator>>;
+
+    template<size_t size>
+    static CPUStorage<size, CPUHeapLayout<Allocator>> create() {
+        return CPUStorage<size, CPUHeapLayout<Allocator>>();
+    }
+};
+
 #endif //CPUSTORAGE_H
@@ -0,0 +1,237 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef CPUSTORAGELAYOUT_H
+#define CPUSTORAGELAYOUT_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include <core/limb/LimbEngine.h>
+
+/**
+ * @brief Byte buffer backed by 64-byte aligned 64-bit limbs.
+ *
+ * Exposes the same byte-level interface as std::array<uint8_t, byteCount> so CPUStorage can
+ * use it unchanged, while the underlying limbs are padded up to a whole limb. The padding
+ * bytes are never reachable through the byte interface and stay zero.
+ *
+ * @tparam byteCount Logical size in bytes.
+ */
+template<size_t byteCount>
+class CPULimbBuffer {
+public:
+    static constexpr size_t limbCount = LimbCountForBits(byteCount << 3);
+    static constexpr size_t alignment = 64;
+
+    uint8_t& operator[](size_t index) {
+        return data()[index];
+    }
+    const uint8_t& operator[](size_t index) const {
+        return data()[index];
+    }
+    uint8_t* data() {
+        return reinterpret_cast<uint8_t*>(limbs_);
+    }
+    const uint8_t* data() const {
+        return reinterpret_cast<const uint8_t*>(limbs_);
+    }
+    uint8_t* begin() {
+        return data();
+    }
+    const uint8_t* begin() const {
+        return data();
+    }
+    uint8_t* end() {
+        return data() + byteCount;
+    }
+    const uint8_t* end() const {
+        return data() + byteCount;
+    }
+    static constexpr size_t size() {
+        return byteCount;
+    }
+    void fill(uint8_t value) {
+        std::fill(begin(), end(), value);
+    }
+
+    // Limb view. On big-endian hosts limbs hold the bytes in memory order, so portable kernels
+    // should go through LimbLoad/LimbStore.
+    Limb* limbs() {
+        return limbs_;
+    }
+    const Limb* limbs() const {
+        return limbs_;
+    }
+
+    bool operator==(const CPULimbBuffer& other) const {
+        return std::memcmp(limbs_, other.limbs_, sizeof(limbs_)) == 0;
+    }
+
+private:
+    alignas(alignment) Limb limbs_[limbCount] = {};
+};
+
+/**
+ * @brief Byte buffer whose limbs live on the heap, obtained from a pluggable allocator.
+ *
+ * Keeps CPUStorage to a single pointer plus the allocator, so very wide values do not sit on the
+ * stack. Moves steal the pointer; a moved-from buffer may only be assigned to or destroyed.
+ * Limbs are padded up to a whole limb and the padding stays zero, as in CPULimbBuffer.
+ *
+ * @tparam byteCount Logical size in bytes.
+ * @tparam Allocator Allocator for the limbs, e.g. std::pmr::polymorphic_allocator<Limb> over an
+ * arena or pool resource.
+ */
+template<size_t byteCount, typename Allocator>
+class CPUHeapBuffer {
+public:
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<Limb>;
+    static constexpr size_t limbCount = LimbCountForBits(byteCount << 3);
+    static constexpr size_t alignment = alignof(Limb);
+
+    CPUHeapBuffer() : limbs_(Allocate()) {}
+    explicit CPUHeapBuffer(const allocator_type& allocator) : allocator_(allocator), limbs_(Allocate()) {}
+    CPUHeapBuffer(const CPUHeapBuffer& other)
+        : allocator_(AllocatorTraits::select_on_container_copy_construction(other.allocator_)), limbs_(Allocate()) {
+        std::memcpy(limbs_, other.limbs_, sizeof(Limb) * limbCount);
+    }
+    CPUHeapBuffer(CPUHeapBuffer&& other) noexcept
+        : allocator_(std::move(other.allocator_)), limbs_(std::exchange(other.limbs_, nullptr)) {}
+    ~CPUHeapBuffer() {
+        Release();
+    }
+
+    CPUHeapBuffer& operator=(const CPUHeapBuffer& other) {
+        if (this != &other) {
+            if (limbs_ == nullptr) {
+                limbs_ = Allocate();
+            }
+            std::memcpy(limbs_, other.limbs_, sizeof(Limb) * limbCount);
+        }
+        return *this;
+    }
+    CPUHeapBuffer& operator=(CPUHeapBuffer&& other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                             AllocatorTraits::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+            Release();
+            allocator_ = std::move(other.allocator_);
+            limbs_ = std::exchange(other.limbs_, nullptr);
+        }
+        else if (AllocatorTraits::is_always_equal::value || allocator_ == other.allocator_) {
+            // Same arena: trade pointers so other stays usable
+            std::swap(limbs_, other.limbs_);
+        }
+        else {
+            // Different arenas: the limbs have to stay in ours
+            *this = static_cast<const CPUHeapBuffer&>(other);
+        }
+        return *this;
+    }
+
+    uint8_t& operator[](size_t index) {
+        return data()[index];
+    }
+    const uint8_t& operator[](size_t index) const {
+        return data()[index];
+    }
+    uint8_t* data() {
+        return reinterpret_cast<uint8_t*>(limbs_);
+    }
+    const uint8_t* data() const {
+        return reinterpret_cast<const uint8_t*>(limbs_);
+    }
+    uint8_t* begin() {
+        return data();
+    }
+    const uint8_t* begin() const {
+        return data();
+    }
+    uint8_t* end() {
+        return data() + byteCount;
+    }
+    const uint8_t* end() const {
+        return data() + byteCount;
+    }
+    static constexpr size_t size() {
+        return byteCount;
+    }
+    void fill(uint8_t value) {
+        std::fill(begin(), end(), value);
+    }
+
+    Limb* limbs() {
+        return limbs_;
+    }
+    const Limb* limbs() const {
+        return limbs_;
+    }
+    allocator_type get_allocator() const {
+        return allocator_;
+    }
+
+    bool operator==(const CPUHeapBuffer& other) const {
+        return std::memcmp(limbs_, other.limbs_, sizeof(Limb) * limbCount) == 0;
+    }
+
+private:
+    using AllocatorTraits = std::allocator_traits<allocator_type>;
+
+    Limb* Allocate() {
+        Limb* limbs = AllocatorTraits::allocate(allocator_, limbCount);
+        std::fill(limbs, limbs + limbCount, Limb{0});
+        return limbs;
+    }
+    void Release() {
+        if (limbs_ != nullptr) {
+            AllocatorTraits::deallocate(allocator_, limbs_, limbCount);
+            limbs_ = nullptr;
+        }
+    }
+
+    [[no_unique_address]] allocator_type allocator_;
+    Limb* limbs_;
+};
+
+/**
+ * @brief Default CPUStorage layout: a plain byte array with no alignment guarantee.
+ */
+struct CPUByteLayout {
+    template<size_t size>
+    using Buffer = std::array<uint8_t, size>;
+    static constexpr size_t alignment = alignof(uint8_t);
+};
+
+/**
+ * @brief CPUStorage layout that keeps its bytes in 64-byte aligned limbs padded to a whole limb,
+ * so wide kernels can issue aligned vector loads.
+ */
+struct CPULimbLayout {
+    template<size_t size>
+    using Buffer = CPULimbBuffer<size>;
+    static constexpr size_t alignment = 64;
+};
+
+/**
+ * @brief CPUStorage layout that keeps its limbs on the heap (see CPUHeapBuffer).
+ *
+ * @tparam Allocator Limb allocator. The default polymorphic allocator draws from
+ * std::pmr::get_default_resource(), so an arena or pool can be plugged in at run time.
+ */
+template<typename Allocator = std::pmr::polymorphic_allocator<Limb>>
+struct CPUHeapLayout {
+    template<size_t size>
+    using Buffer = CPUHeapBuffer<size, Allocator>;
+    static constexpr size_t alignment = alignof(Limb);
+};
+
+#endif //CPUSTORAGELAYOUT_H
@@ -13,5 +13,6 @@
 #include <storage/cpu-storage/impl/CPUStorage_ByteAnalyzable.inl>
 #include <storage/cpu-storage/impl/CPUStorage_ByteCopyable.inl>
 #include <storage/cpu-storage/impl/CPUStorage_ByteManipulable.inl>
+#include <storage/cpu-storage/impl/CPUStorage_LimbAccessible.inl>
 
 #endif //CPUSTORAGEIMPL_H
@@ -5,8 +5,8 @@
 #define CPUSTORAGE_BITANALYZABLE_INL
 
 // BitAnalyzable implementations
-template<size_t size>
-size_t CPUStorage<size>::PopCount() const {
+template<size_t size, typename Layout>
+size_t CPUStorage<size, Layout>::PopCount() const {
     size_t count = 0;
     for (size_t i = 0; i < size; ++i) {
         count += std::popcount(data_[i]);
@@ -14,8 +14,8 @@ size_t CPUStorage<size>::PopCount() const {
     return count;
 }
 
-template<size_t size>
-size_t CPUStorage<size>::CountLeadingZeros() const {
+template<size_t size, typename Layout>
+size_t CPUStorage<size, Layout>::CountLeadingZeros() const {
     size_t count = 0;
     for (size_t i = size - 1; i < size; --i) {
         if (data_[i] == 0) {
@@ -28,8 +28,8 @@ size_t CPUStorage<size>::CountLeadingZeros() const {
     return count;
 }
 
-template<size_t size>
-size_t CPUStorage<size>::CountTrailingZeros() const {
+template<size_t size, typename Layout>
+size_t CPUStorage<size, Layout>::CountTrailingZeros() const {
     size_t count = 0;
     for (size_t i = 0; i < size; ++i) {
         if (data_[i] == 0) {
@@ -42,8 +42,8 @@ size_t CPUStorage<size>::CountTrailingZeros() const {
     return count;
 }
 
-template<size_t size>
-size_t CPUStorage<size>::CountLeadingOnes() const {
+template<size_t size, typename Layout>
+size_t CPUStorage<size, Layout>::CountLeadingOnes() const {
     size_t count = 0;
     for (size_t i = size - 1; i < size; --i) {
         if (data_[i] == 0xFF) {
@@ -56,8 +56,8 @@ size_t CPUStorage<size>::CountLeadingOnes() const {
     return count;
 }
 
-template<size_t size>
-size_t CPUStorage<size>::CountTrailingOnes() const {
+template<size_t size, typename Layout>
+size_t CPUStorage<size, Layout>::CountTrailingOnes() const {
     size_t count = 0;
     for (size_t i = 0; i < size; ++i) {
         if (data_[i] == 0xFF) {
@@ -70,8 +70,8 @@ size_t CPUStorage<size>::CountTrailingOnes() const {
     return count;
 }
 
-template<size_t size>
-std::optional<size_t> CPUStorage<size>::FindFirstSet() const {
+template<size_t size, typename Layout>
+std::optional<size_t> CPUStorage<size, Layout>::FindFirstSet() const {
     for (size_t i = 0; i < size; ++i) {
         if (data_[i] != 0) {
             return i * 8 + std::countr_zero(data_[i]);
@@ -80,8 +80,8 @@ std::optional<size_t> CPUStorage<size>::FindFirstSet() const {
     return std::nullopt;
 }
 
-template<size_t size>
-std::optional<size_t> CPUStorage<size>::FindFirstClear() const {
+template<size_t size, typename Layout>
+std::optional<size_t> CPUStorage<size, Layout>::FindFirstClear() const {
     for (size_t i = 0; i < size; ++i) {
         if (data_[i] != 0xFF) {
             return i * 8 + std::countr_one(data_[i]);
@@ -90,8 +90,8 @@ std::optional<size_t> CPUStorage<size>::FindFirstClear() const {
     return std::nullopt;
 }
 
-template<size_t size>
-std::optional<size_t> CPUStorage<size>::FindLastSet() const {
+template<size_t size, typename Layout>
+std::optional<size_t> CPUStorage<size, Layout>::FindLastSet() const {
     for (size_t i = size - 1; i < size; --i) {
         if (data_[i] != 0) {
             return i * 8 + 7 - std::countl_zero(data_[i]);
@@ -100,8 +100,8 @@ std::optional<size_t> CPUStorage<size>::FindLastSet() const {
     return std::nullopt;
 }
 
-template<size_t size>
-std::optional<size_t> CPUStorage<size>::FindLastClear() const {
+template<size_t size, typename Layout>
+std::optional<size_t> CPUStorage<size, Layout>::FindLastClear() const {
     for (size_t i = size - 1; i < size; --i) {
         if (data_[i] != 0xFF) {
             return i * 8 + 7 - std::countl_one(data_[i]);
@@ -110,38 +110,44 @@ std::optional<size_t> CPUStorage<size>::FindLastClear() const {
     return std::nullopt;
 }
 
-template<size_t size>
-bool CPUStorage<size>::IsAllZeros() const {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::IsAllZeros() const {
     return std::all_of(data_.begin(), data_.end(), [](uint8_t b) { return b == 0; });
 }
 
-template<size_t size>
-bool CPUStorage<size>::IsAllOnes() const {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::IsAllOnes() const {
     return std::all_of(data_.begin(), data_.end(), [](uint8_t b) { return b == 0xFF; });
 }
 
-template<size_t size>
-bool CPUStorage<size>::IsPowerOfTwo() const {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::IsPowerOfTwo() const {
     return PopCount() == 1;
 }
 
-template<size_t size>
-bool CPUStorage<size>::HasEvenParity() const {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::HasEvenParity() const {
     return PopCount() % 2 == 0;
 }
 
-template<size_t size>
-bool CPUStorage<size>::HasOddParity() const {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::HasOddParity() const {
     return PopCount() % 2 != 0;
 }
 
-template<size_t size>
-bool CPUStorage<size>::TestBitRange(size_t start, size_t count, bool expectedValue) const {
-    for (size_t i = 0; i < count; ++i) {
-        if (GetBit(start + i) != expectedValue) {
+template<size_t size, typename Layout>
+bool CPUStorage<size, Layout>::TestBitRange(size_t start, size_t count, bool expectedValue) const {
+    // A limb at a time; bits past the end throw like GetBit once everything before them matched
+    const size_t inRange = start < totalBits ? std::min(count, totalBits - start) : 0;
+    for (size_t done = 0; done < inRange; done += LimbBits) {
+        const Limb mask = LimbMask(inRange - done);
+        if ((LoadLimb(start + done) & mask) != (expectedValue ? mask : 0)) {
             return false;
         }
     }
+    if (inRange < count) {
+        throw std::out_of_range("Bit index out of bounds");
+    }
     return true;
 }
 
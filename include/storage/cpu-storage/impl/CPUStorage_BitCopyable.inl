@@ -6,15 +6,15 @@
 #define CPUSTORAGE_BITCOPYABLE_INL
 
 // BitCopyable implementations
-template<size_t size>
-void CPUStorage<size>::CopyBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::CopyBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart) {
     for (size_t i = 0; i < bitCount; ++i) {
         SetBit(dstStart + i, GetBit(srcStart + i));
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::MoveBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::MoveBitsInternal(size_t srcStart, size_t bitCount, size_t dstStart) {
     if (dstStart > srcStart) {
         for (size_t i = bitCount; i > 0; --i) {
             SetBit(dstStart + i - 1, GetBit(srcStart + i - 1));
@@ -26,46 +26,46 @@ void CPUStorage<size>::MoveBitsInternal(size_t srcStart, size_t bitCount, size_t
     }
 }
 
-template<size_t size>
-template<size_t OtherSize>
-void CPUStorage<size>::CopyBitsFrom(const CPUStorage<OtherSize>& source, size_t srcStart, size_t bitCount, size_t dstStart) {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+void CPUStorage<size, Layout>::CopyBitsFrom(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t bitCount, size_t dstStart) {
     for (size_t i = 0; i < bitCount; ++i) {
         SetBit(dstStart + i, source.GetBit(srcStart + i));
     }
 }
 
-template<size_t size>
-template<size_t OtherSize>
-void CPUStorage<size>::CopyBitsTo(CPUStorage<OtherSize>& destination, size_t srcStart, size_t bitCount, size_t dstStart) const {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+void CPUStorage<size, Layout>::CopyBitsTo(CPUStorage<OtherSize, OtherLayout>& destination, size_t srcStart, size_t bitCount, size_t dstStart) const {
     for (size_t i = 0; i < bitCount; ++i) {
         destination.SetBit(dstStart + i, GetBit(srcStart + i));
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::SetBitRange(size_t start, size_t count) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::SetBitRange(size_t start, size_t count) {
     for (size_t i = 0; i < count; ++i) {
         SetBit(start + i);
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::ClearBitRange(size_t start, size_t count) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ClearBitRange(size_t start, size_t count) {
     for (size_t i = 0; i < count; ++i) {
         ClearBit(start + i);
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::FlipBitRange(size_t start, size_t count) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::FlipBitRange(size_t start, size_t count) {
     for (size_t i = 0; i < count; ++i) {
         FlipBit(start + i);
     }
 }
 
-template<size_t size>
-template<size_t OtherSize>
-bool CPUStorage<size>::CanCopyBits(const CPUStorage<OtherSize>& source, size_t srcStart, size_t bitCount, size_t dstStart) const {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+bool CPUStorage<size, Layout>::CanCopyBits(const CPUStorage<OtherSize, OtherLayout>& source, size_t srcStart, size_t bitCount, size_t dstStart) const {
     return srcStart + bitCount <= source.GetByteSize() * 8 && dstStart + bitCount <= GetByteSize() * 8;
 }
 
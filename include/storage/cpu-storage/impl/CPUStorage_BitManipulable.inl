@@ -6,157 +6,186 @@
 #define CPUSTORAGE_BITMANIPULABLE_INL
 
 // BitManipulable implementations
-template<size_t size>
-void CPUStorage<size>::ShiftLeft(size_t positions) {
-    if (positions == 0) {
-        return;
-    }
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftLeft(size_t positions) {
+    ShiftRangeLeft(0, totalBits, positions);
+}
 
-    size_t byteOffset = positions >> 3;
-    size_t bitOffset = positions & 7;
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftRight(size_t positions) {
+    ShiftRangeRight(0, totalBits, positions);
+}
 
-    if (bitOffset != 0) {
-        // Process from HIGH to LOW bytes (right to left)
-        for (size_t i = size - 1; i >= 1; --i) {
-            data_[i] <<= bitOffset;
-            data_[i] |= data_[i - 1] >> (8 - bitOffset); // Get carry from lower byte
-        }
-        // Handle the lowest byte (no carry from below)
-        data_[0] <<= bitOffset;
-    }
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::RotateLeft(size_t positions) {
+    RotateRangeLeft(0, totalBits, positions);
+}
 
-    ShiftBytesLeft(byteOffset);
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::RotateRight(size_t positions) {
+    RotateRangeRight(0, totalBits, positions);
 }
 
-template<size_t size>
-void CPUStorage<size>::ShiftRight(size_t positions) {
-    if (positions == 0) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftRangeLeft(size_t start, size_t count, size_t positions) {
+    if (start >= totalBits || positions == 0) {
         return;
     }
+    count = std::min(count, totalBits - start);
 
-    size_t byteOffset = positions >> 3;
-    size_t bitOffset = positions & 7;
-    ShiftBytesRight(byteOffset);
-    if (bitOffset == 0) {
+    // Funnel shift a limb at a time, most significant limb first so every source is read before it is overwritten
+    for (size_t chunk = (count + LimbBits - 1) / LimbBits; chunk-- > 0;) {
+        const size_t done = chunk * LimbBits;
+        Limb value = 0;
+        if (done >= positions) {
+            value = LoadLimb(start + done - positions);
+        }
+        else if (positions - done < LimbBits) {
+            // Zeros come in from below the range
+            value = LoadLimb(start) << (positions - done);
+        }
+        StoreLimb(start + done, value, std::min(LimbBits, count - done));
+    }
+}
+
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftRangeRight(size_t start, size_t count, size_t positions) {
+    if (start >= totalBits || positions == 0) {
         return;
     }
-    for (size_t i = 0; i < size - 1; ++i) {
-        data_[i] >>= bitOffset;
-        data_[i] |= data_[i + 1] << (8 - bitOffset);
+    count = std::min(count, totalBits - start);
+
+    // Least significant limb first; zeros come in from above the range
+    for (size_t done = 0; done < count; done += LimbBits) {
+        const size_t source = done + positions;
+        const Limb value = source < count ?
+                               LoadLimb(start + source) & LimbMask(count - source) :
+                               0;
+        StoreLimb(start + done, value, std::min(LimbBits, count - done));
     }
-    // Handle the highest byte (no carry from above)
-    data_[size - 1] >>= bitOffset;
 }
 
-template<size_t size>
-void CPUStorage<size>::RotateLeft(size_t positions) {
-    positions %= totalBits; // Handle rotations larger than size
-    if (positions == 0)
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::RotateRangeLeft(size_t start, size_t count, size_t positions) {
+    if (start >= totalBits) {
+        return;
+    }
+    count = std::min(count, totalBits - start);
+    if (count == 0 || positions % count == 0) {
         return;
-
-    // Save the bits that will wrap around
-    std::vector<bool> wrapBits(positions);
-    for (size_t i = 0; i < positions; ++i) {
-        wrapBits[i] = GetBit(totalBits - positions + i);
     }
+    positions %= count;
 
-    // Shift left
-    ShiftLeft(positions);
+    // Snapshot the range on the stack, then funnel each destination limb out of it with wrap-around
+    std::array<Limb, LimbCountForBits(totalBits)> snapshot;
+    const size_t limbCount = (count + LimbBits - 1) / LimbBits;
+    for (size_t i = 0; i < limbCount; ++i) {
+        snapshot[i] = LoadLimb(start + i * LimbBits);
+    }
+    snapshot[limbCount - 1] &= LimbMask(count - (limbCount - 1) * LimbBits);
 
-    // Set the wrapped bits
-    for (size_t i = 0; i < positions; ++i) {
-        if (wrapBits[i]) {
-            SetBit(i);
+    auto window = [&](size_t bit) {
+        const size_t index = bit / LimbBits;
+        const size_t shift = bit % LimbBits;
+        Limb value = snapshot[index] >> shift;
+        if (shift != 0 && index + 1 < limbCount) {
+            value |= snapshot[index + 1] << (LimbBits - shift);
         }
-        else {
-            ClearBit(i);
+        return value;
+    };
+
+    for (size_t done = 0; done < count; done += LimbBits) {
+        // Destination bit j takes source bit (j - positions) mod count
+        const size_t source = (done + count - positions) % count;
+        Limb value = window(source);
+        if (count - source < LimbBits) {
+            value |= window(0) << (count - source);
         }
+        StoreLimb(start + done, value, std::min(LimbBits, count - done));
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::RotateRight(size_t positions) {
-    positions %= totalBits;
-    if (positions == 0)
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::RotateRangeRight(size_t start, size_t count, size_t positions) {
+    if (start >= totalBits) {
         return;
-
-    // Save the bits that will wrap around
-    std::vector<bool> wrapBits(positions);
-    for (size_t i = 0; i < positions; ++i) {
-        wrapBits[i] = GetBit(i);
     }
-
-    // Shift right
-    ShiftRight(positions);
-
-    // Set the wrapped bits
-    for (size_t i = 0; i < positions; ++i) {
-        if (wrapBits[i]) {
-            SetBit(totalBits - positions + i);
-        }
-        else {
-            ClearBit(totalBits - positions + i);
-        }
+    count = std::min(count, totalBits - start);
+    if (count == 0) {
+        return;
     }
+    RotateRangeLeft(start, count, count - positions % count);
 }
 
-template<size_t size>
-void CPUStorage<size>::ReverseBits() {
-    for (size_t i = 0; i < totalBits / 2; ++i) {
-        bool leftBit = GetBit(i);
-        bool rightBit = GetBit(totalBits - 1 - i);
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ReverseBits() {
+    ReverseBitRange(0, totalBits);
+}
 
-        if (leftBit) {
-            SetBit(totalBits - 1 - i);
-        }
-        else {
-            ClearBit(totalBits - 1 - i);
-        }
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ReverseBitRange(size_t start, size_t count) {
+    if (start >= totalBits) {
+        return;
+    }
+    count = std::min(count, totalBits - start);
+    if (count < 2) {
+        return;
+    }
 
-        if (rightBit) {
-            SetBit(i);
-        }
-        else {
-            ClearBit(i);
-        }
+    // Snapshot the range on the stack and reverse it a limb pair at a time
+    std::array<Limb, LimbCountForBits(totalBits)> snapshot;
+    const size_t limbCount = (count + LimbBits - 1) / LimbBits;
+    for (size_t i = 0; i < limbCount; ++i) {
+        snapshot[i] = LoadLimb(start + i * LimbBits);
+    }
+    snapshot[limbCount - 1] &= LimbMask(count - (limbCount - 1) * LimbBits);
+    LimbReverseBitsN(snapshot.data(), snapshot.data(), limbCount);
+
+    // The reversed range now sits in the top count bits of the snapshot
+    const unsigned padding = static_cast<unsigned>(limbCount * LimbBits - count);
+    if (padding != 0) {
+        LimbShiftRight(snapshot.data(), snapshot.data(), limbCount, padding);
+    }
+    for (size_t done = 0; done < count; done += LimbBits) {
+        StoreLimb(start + done, snapshot[done / LimbBits], std::min(LimbBits, count - done));
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::ReverseBytes() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ReverseBytes() {
     std::reverse(data_.begin(), data_.end());
 }
 
-template<size_t size>
-void CPUStorage<size>::BitwiseAnd(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BitwiseAnd(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] &= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BitwiseOr(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BitwiseOr(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] |= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BitwiseXor(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BitwiseXor(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] ^= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BitwiseNot() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BitwiseNot() {
     for (size_t i = 0; i < size; ++i) {
         data_[i] = ~data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::Increment() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::Increment() {
     for (size_t i = 0; i < size; ++i) {
         if (++data_[i] != 0) {
             break;
@@ -164,8 +193,8 @@ void CPUStorage<size>::Increment() {
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::Decrement() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::Decrement() {
     for (size_t i = 0; i < size; ++i) {
         if (--data_[i] != 0xFF) {
             break;
@@ -173,176 +202,94 @@ void CPUStorage<size>::Decrement() {
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::OffsetAdd(size_t offset, size_t bitWidth, size_t value) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::OffsetAdd(size_t offset, size_t bitWidth, size_t value) {
     if (offset + bitWidth > totalBits) {
         throw std::out_of_range("Bit range out of bounds in OffsetAdd");
     }
 
-    bool carry = false;
-    for (size_t i = 0; i < bitWidth; ++i) {
-        bool current_bit = GetBit(offset + i);
-        bool value_bit = (value >> i) & 1;
-
-        bool sum_bit = current_bit ^ value_bit ^ carry;
-        carry = (current_bit && value_bit) || (current_bit && carry) || (value_bit && carry);
-
-        SetBit(offset + i, sum_bit);
-    }
+    AddLimbRange(offset, bitWidth, [value](size_t done) -> Limb { return done == 0 ? value : 0; }, false);
 }
 
-template<size_t size>
-void CPUStorage<size>::OffsetSub(size_t offset, size_t bitWidth, size_t value) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::OffsetSub(size_t offset, size_t bitWidth, size_t value) {
     if (offset + bitWidth > totalBits) {
         throw std::out_of_range("Bit range out of bounds in OffsetSub");
     }
 
-    bool borrow = false;
-    for (size_t i = 0; i < bitWidth; ++i) {
-        bool current_bit = GetBit(offset + i);
-        bool value_bit = (value >> i) & 1;
-
-        bool diff_bit = current_bit ^ value_bit ^ borrow;
-        borrow = (!current_bit && value_bit) || (!current_bit && borrow) || (value_bit && borrow);
-
-        SetBit(offset + i, diff_bit);
-    }
+    SubLimbRange(offset, bitWidth, [value](size_t done) -> Limb { return done == 0 ? value : 0; }, false);
 }
 
-template<size_t size>
-template<size_t OtherSize>
-void CPUStorage<size>::OffsetAdd(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart) {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+void CPUStorage<size, Layout>::OffsetAdd(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart) {
     if (srcStart + srcWidth > ct.totalBits) {
         throw std::out_of_range("Source bit range out of bounds in OffsetAdd (CPUStorage overload)");
     }
 
-    bool carry = false;
-    for (size_t i = 0; i < srcWidth; ++i) {
-        if (dstStart + i >= totalBits) {
-            // Discard leftover bits
-            break;
-        }
-        bool current_dst_bit = GetBit(dstStart + i);
-        bool src_bit = ct.GetBit(srcStart + i);
-
-        bool sum_bit = current_dst_bit ^ src_bit ^ carry;
-        carry = (current_dst_bit && src_bit) || (current_dst_bit && carry) || (src_bit && carry);
-
-        SetBit(dstStart + i, sum_bit);
-    }
+    // Discard leftover bits past the end of this storage
+    const size_t width = dstStart >= totalBits ? 0 : std::min(srcWidth, totalBits - dstStart);
+    AddLimbRange(dstStart, width, [&ct, srcStart](size_t done) { return ct.LoadLimb(srcStart + done); }, false);
 }
 
-template<size_t size>
-template<size_t OtherSize>
-void CPUStorage<size>::OffsetSub(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart) {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+void CPUStorage<size, Layout>::OffsetSub(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart) {
     if (srcStart + srcWidth > ct.totalBits) {
         throw std::out_of_range("Source bit range out of bounds in OffsetSub (CPUStorage overload)");
     }
 
-    bool borrow = false;
-    for (size_t i = 0; i < srcWidth; ++i) {
-        if (dstStart + i >= totalBits) {
-            // Discard leftover bits
-            break;
-        }
-        bool current_dst_bit = GetBit(dstStart + i);
-        bool src_bit = ct.GetBit(srcStart + i);
-
-        bool diff_bit = current_dst_bit ^ src_bit ^ borrow;
-        borrow = (!current_dst_bit && src_bit) || (!current_dst_bit && borrow) || (src_bit && borrow);
-
-        SetBit(dstStart + i, diff_bit);
-    }
+    // Discard leftover bits past the end of this storage
+    const size_t width = dstStart >= totalBits ? 0 : std::min(srcWidth, totalBits - dstStart);
+    SubLimbRange(dstStart, width, [&ct, srcStart](size_t done) { return ct.LoadLimb(srcStart + done); }, false);
 }
 
-template<size_t size>
-std::pair<CPUStorage<size>, bool> CPUStorage<size>::OffsetAddWithCarry(size_t offset, size_t bitWidth, size_t value, bool initialCarry) {
+template<size_t size, typename Layout>
+std::pair<CPUStorage<size, Layout>, bool> CPUStorage<size, Layout>::OffsetAddWithCarry(size_t offset, size_t bitWidth, size_t value, bool initialCarry) {
     if (offset + bitWidth > totalBits) {
         throw std::out_of_range("Bit range out of bounds in OffsetAddWithCarry");
     }
 
-    CPUStorage<size> temp_storage = *this;
-    bool carry = initialCarry;
-    for (size_t i = 0; i < bitWidth; ++i) {
-        bool current_bit = temp_storage.GetBit(offset + i);
-        bool value_bit = (value >> i) & 1;
-
-        bool sum_bit = current_bit ^ value_bit ^ carry;
-        carry = (current_bit && value_bit) || (current_bit && carry) || (value_bit && carry);
-
-        temp_storage.SetBit(offset + i, sum_bit);
-    }
+    CPUStorage<size, Layout> temp_storage = *this;
+    const bool carry = temp_storage.AddLimbRange(offset, bitWidth, [value](size_t done) -> Limb { return done == 0 ? value : 0; }, initialCarry);
     return { temp_storage, carry };
 }
 
-template<size_t size>
-std::pair<CPUStorage<size>, bool> CPUStorage<size>::OffsetSubWithBorrow(size_t offset, size_t bitWidth, size_t value, bool initialBorrow) {
+template<size_t size, typename Layout>
+std::pair<CPUStorage<size, Layout>, bool> CPUStorage<size, Layout>::OffsetSubWithBorrow(size_t offset, size_t bitWidth, size_t value, bool initialBorrow) {
     if (offset + bitWidth > totalBits) {
         throw std::out_of_range("Bit range out of bounds in OffsetSubWithBorrow");
     }
 
-    CPUStorage<size> temp_storage = *this;
-    bool borrow = initialBorrow;
-    for (size_t i = 0; i < bitWidth; ++i) {
-        bool current_bit = temp_storage.GetBit(offset + i);
-        bool value_bit = (value >> i) & 1;
-
-        bool diff_bit = current_bit ^ value_bit ^ borrow;
-        borrow = (!current_bit && value_bit) || (!current_bit && borrow) || (value_bit && borrow);
-
-        temp_storage.SetBit(offset + i, diff_bit);
-    }
+    CPUStorage<size, Layout> temp_storage = *this;
+    const bool borrow = temp_storage.SubLimbRange(offset, bitWidth, [value](size_t done) -> Limb { return done == 0 ? value : 0; }, initialBorrow);
     return { temp_storage, borrow };
 }
 
-template<size_t size>
-template<size_t OtherSize>
-std::pair<CPUStorage<size>, bool> CPUStorage<size>::OffsetAddWithCarry(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialCarry) {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+std::pair<CPUStorage<size, Layout>, bool> CPUStorage<size, Layout>::OffsetAddWithCarry(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialCarry) {
     if (srcStart + srcWidth > ct.totalBits) {
         throw std::out_of_range("Source bit range out of bounds in OffsetAddWithCarry (CPUStorage overload)");
     }
 
-    CPUStorage<size> temp_storage = *this;
-    bool carry = initialCarry;
-    for (size_t i = 0; i < srcWidth; ++i) {
-        if (dstStart + i >= totalBits) {
-            // Discard leftover bits
-            break;
-        }
-        bool current_dst_bit = temp_storage.GetBit(dstStart + i);
-        bool src_bit = ct.GetBit(srcStart + i);
-
-        bool sum_bit = current_dst_bit ^ src_bit ^ carry;
-        carry = (current_dst_bit && src_bit) || (current_dst_bit && carry) || (src_bit && carry);
-
-        temp_storage.SetBit(dstStart + i, sum_bit);
-    }
+    CPUStorage<size, Layout> temp_storage = *this;
+    const size_t width = dstStart >= totalBits ? 0 : std::min(srcWidth, totalBits - dstStart);
+    const bool carry = temp_storage.AddLimbRange(dstStart, width, [&ct, srcStart](size_t done) { return ct.LoadLimb(srcStart + done); }, initialCarry);
     return { temp_storage, carry };
 }
 
-template<size_t size>
-template<size_t OtherSize>
-std::pair<CPUStorage<size>, bool> CPUStorage<size>::OffsetSubWithBorrow(const CPUStorage<OtherSize>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialBorrow) {
+template<size_t size, typename Layout>
+template<size_t OtherSize, typename OtherLayout>
+std::pair<CPUStorage<size, Layout>, bool> CPUStorage<size, Layout>::OffsetSubWithBorrow(const CPUStorage<OtherSize, OtherLayout>& ct, size_t srcStart, size_t srcWidth, size_t dstStart, bool initialBorrow) {
     if (srcStart + srcWidth > ct.totalBits) {
         throw std::out_of_range("Source bit range out of bounds in OffsetSubWithBorrow (CPUStorage overload)");
     }
 
-    CPUStorage<size> temp_storage = *this;
-    bool borrow = initialBorrow;
-    for (size_t i = 0; i < srcWidth; ++i) {
-        if (dstStart + i >= totalBits) {
-            // Discard leftover bits
-            break;
-        }
-        bool current_dst_bit = temp_storage.GetBit(dstStart + i);
-        bool src_bit = ct.GetBit(srcStart + i);
-
-        bool diff_bit = current_dst_bit ^ src_bit ^ borrow;
-        borrow = (!current_dst_bit && src_bit) || (!current_dst_bit && borrow) || (src_bit && borrow);
-
-        temp_storage.SetBit(dstStart + i, diff_bit);
-    }
+    CPUStorage<size, Layout> temp_storage = *this;
+    const size_t width = dstStart >= totalBits ? 0 : std::min(srcWidth, totalBits - dstStart);
+    const bool borrow = temp_storage.SubLimbRange(dstStart, width, [&ct, srcStart](size_t done) { return ct.LoadLimb(srcStart + done); }, initialBorrow);
     return { temp_storage, borrow };
 }
 
-#endif //CPUSTORAGE_BITMANIPULABLE_INL
\ No newline at end of file
+#endif //CPUSTORAGE_BITMANIPULABLE_INL
@@ -6,42 +6,42 @@
 #define CPUSTORAGE_BYTEACCESSIBLE_INL
 
 // ByteAccessible implementations
-template<size_t size>
-uint8_t& CPUStorage<size>::operator[](size_t index) {
+template<size_t size, typename Layout>
+uint8_t& CPUStorage<size, Layout>::operator[](size_t index) {
     if (index >= size)
         throw std::out_of_range("Index out of bounds");
     return data_[index];
 }
 
-template<size_t size>
-const uint8_t& CPUStorage<size>::operator[](size_t index) const {
+template<size_t size, typename Layout>
+const uint8_t& CPUStorage<size, Layout>::operator[](size_t index) const {
     if (index >= size)
         throw std::out_of_range("Index out of bounds");
     return data_[index];
 }
 
-template<size_t size>
-uint8_t* CPUStorage<size>::Data() {
+template<size_t size, typename Layout>
+uint8_t* CPUStorage<size, Layout>::Data() {
     return data_.data();
 }
 
-template<size_t size>
-const uint8_t* CPUStorage<size>::Data() const {
+template<size_t size, typename Layout>
+const uint8_t* CPUStorage<size, Layout>::Data() const {
     return data_.data();
 }
 
-template<size_t size>
-constexpr size_t CPUStorage<size>::GetByteSize() const {
+template<size_t size, typename Layout>
+constexpr size_t CPUStorage<size, Layout>::GetByteSize() const {
     return size;
 }
 
-template<size_t size>
-void CPUStorage<size>::Fill(uint8_t value) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::Fill(uint8_t value) {
     data_.fill(value);
 }
 
-template<size_t size>
-void CPUStorage<size>::Clear() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::Clear() {
     data_.fill(0);
 }
 
@@ -6,18 +6,18 @@
 #define CPUSTORAGE_BYTEMANIPULABLE_INL
 
 // ByteManipulable implementations
-template<size_t size>
-void CPUStorage<size>::SwapBytes(size_t index1, size_t index2) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::SwapBytes(size_t index1, size_t index2) {
     std::swap(data_[index1], data_[index2]);
 }
 
-template<size_t size>
-void CPUStorage<size>::ReverseByteOrder() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ReverseByteOrder() {
     std::reverse(data_.begin(), data_.end());
 }
 
-template<size_t size>
-void CPUStorage<size>::ShiftBytesLeft(size_t positions) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftBytesLeft(size_t positions) {
     if (positions >= size) {
         data_.fill(0);
         return;
@@ -26,8 +26,8 @@ void CPUStorage<size>::ShiftBytesLeft(size_t positions) {
     std::memset(data_.data(), 0, positions);
 }
 
-template<size_t size>
-void CPUStorage<size>::ShiftBytesRight(size_t positions) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftBytesRight(size_t positions) {
     if (positions >= size) {
         data_.fill(0);
         return;
@@ -36,8 +36,8 @@ void CPUStorage<size>::ShiftBytesRight(size_t positions) {
     std::memset(data_.data() + size - positions, 0, positions);
 }
 
-template<size_t size>
-void CPUStorage<size>::ShiftBytesLeft(size_t positions, uint8_t fillValue) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftBytesLeft(size_t positions, uint8_t fillValue) {
     if (positions >= size) {
         data_.fill(fillValue);
         return;
@@ -46,8 +46,8 @@ void CPUStorage<size>::ShiftBytesLeft(size_t positions, uint8_t fillValue) {
     std::memset(data_.data(), fillValue, positions);
 }
 
-template<size_t size>
-void CPUStorage<size>::ShiftBytesRight(size_t positions, uint8_t fillValue) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ShiftBytesRight(size_t positions, uint8_t fillValue) {
     if (positions >= size) {
         data_.fill(fillValue);
         return;
@@ -56,44 +56,44 @@ void CPUStorage<size>::ShiftBytesRight(size_t positions, uint8_t fillValue) {
     std::memset(data_.data() + size - positions, fillValue, positions);
 }
 
-template<size_t size>
-void CPUStorage<size>::ToLittleEndian() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ToLittleEndian() {
     // Already in little endian on most systems, but implement for completeness
 }
 
-template<size_t size>
-void CPUStorage<size>::ToBigEndian() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ToBigEndian() {
     ReverseByteOrder();
 }
 
-template<size_t size>
-void CPUStorage<size>::ToNativeEndian() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::ToNativeEndian() {
     // Assume native is little endian
 }
 
-template<size_t size>
-void CPUStorage<size>::BytewiseAnd(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BytewiseAnd(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] &= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BytewiseOr(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BytewiseOr(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] |= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BytewiseXor(const CPUStorage& other) {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BytewiseXor(const CPUStorage& other) {
     for (size_t i = 0; i < size; ++i) {
         data_[i] ^= other.data_[i];
     }
 }
 
-template<size_t size>
-void CPUStorage<size>::BytewiseNot() {
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::BytewiseNot() {
     for (size_t i = 0; i < size; ++i) {
         data_[i] = ~data_[i];
     }
@@ -0,0 +1,109 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+
+#ifndef CPUSTORAGE_LIMBACCESSIBLE_INL
+#define CPUSTORAGE_LIMBACCESSIBLE_INL
+
+// Limb access implementations
+template<size_t size, typename Layout>
+Limb CPUStorage<size, Layout>::LoadLimb(size_t bitIndex) const {
+    // Returns the 64 bits starting at bitIndex; bits past the end read as zero
+    if (bitIndex >= totalBits) {
+        return 0;
+    }
+
+    const size_t byteIndex = bitIndex >> 3;
+    const size_t shift = bitIndex & 7;
+    if (shift == 0 && byteIndex + LimbBytes <= size) {
+        return LimbLoad(data_.data() + byteIndex);
+    }
+    if (byteIndex + LimbBytes < size) {
+        const Limb low = LimbLoad(data_.data() + byteIndex);
+        return (low >> shift) | (static_cast<Limb>(data_[byteIndex + LimbBytes]) << (LimbBits - shift));
+    }
+
+    // Tail of the storage: go through a zero-padded window
+    uint8_t window[LimbBytes + 1] = {};
+    std::memcpy(window, data_.data() + byteIndex, std::min(size - byteIndex, sizeof(window)));
+    const Limb low = LimbLoad(window);
+    if (shift == 0) {
+        return low;
+    }
+    return (low >> shift) | (static_cast<Limb>(window[LimbBytes]) << (LimbBits - shift));
+}
+
+template<size_t size, typename Layout>
+void CPUStorage<size, Layout>::StoreLimb(size_t bitIndex, Limb value, size_t bitCount) {
+    // Writes the low bitCount bits of value at bitIndex; bits past the end are discarded
+    if (bitIndex >= totalBits || bitCount == 0) {
+        return;
+    }
+
+    const size_t byteIndex = bitIndex >> 3;
+    const size_t shift = bitIndex & 7;
+    if (shift == 0 && bitCount >= LimbBits && byteIndex + LimbBytes <= size) {
+        LimbStore(data_.data() + byteIndex, value);
+        return;
+    }
+
+    const Limb mask = LimbMask(bitCount);
+    value &= mask;
+
+    uint8_t window[LimbBytes + 1] = {};
+    const size_t windowBytes = std::min(size - byteIndex, sizeof(window));
+    std::memcpy(window, data_.data() + byteIndex, windowBytes);
+
+    const Limb low = LimbLoad(window);
+    LimbStore(window, (low & ~(mask << shift)) | (value << shift));
+    if (shift != 0) {
+        // Bits that spill over into the ninth byte
+        const Limb highMask = mask >> (LimbBits - shift);
+        window[LimbBytes] = static_cast<uint8_t>((window[LimbBytes] & ~highMask) | (value >> (LimbBits - shift)));
+    }
+
+    std::memcpy(data_.data() + byteIndex, window, windowBytes);
+}
+
+template<size_t size, typename Layout>
+template<typename SourceLimbs>
+bool CPUStorage<size, Layout>::AddLimbRange(size_t dstStart, size_t bitWidth, SourceLimbs&& sourceLimbs, bool carry) {
+    // sourceLimbs(done) yields the 64 source bits that line up with dstStart + done
+    size_t done = 0;
+    for (; done + LimbBits <= bitWidth; done += LimbBits) {
+        const Limb sum = LimbAddCarry(LoadLimb(dstStart + done), sourceLimbs(done), carry);
+        StoreLimb(dstStart + done, sum);
+    }
+
+    if (done < bitWidth) {
+        // Masked tail limb: the carry out is the bit just above the range
+        const size_t tailBits = bitWidth - done;
+        const Limb mask = LimbMask(tailBits);
+        const Limb sum = (LoadLimb(dstStart + done) & mask) + (sourceLimbs(done) & mask) + carry;
+        carry = (sum >> tailBits) & 1;
+        StoreLimb(dstStart + done, sum, tailBits);
+    }
+    return carry;
+}
+
+template<size_t size, typename Layout>
+template<typename SourceLimbs>
+bool CPUStorage<size, Layout>::SubLimbRange(size_t dstStart, size_t bitWidth, SourceLimbs&& sourceLimbs, bool borrow) {
+    size_t done = 0;
+    for (; done + LimbBits <= bitWidth; done += LimbBits) {
+        const Limb diff = LimbSubBorrow(LoadLimb(dstStart + done), sourceLimbs(done), borrow);
+        StoreLimb(dstStart + done, diff);
+    }
+
+    if (done < bitWidth) {
+        // Masked tail limb: a borrow shows up as the bit just above the range
+        const size_t tailBits = bitWidth - done;
+        const Limb mask = LimbMask(tailBits);
+        const Limb diff = (LoadLimb(dstStart + done) & mask) - (sourceLimbs(done) & mask) - borrow;
+        borrow = (diff >> tailBits) & 1;
+        StoreLimb(dstStart + done, diff, tailBits);
+    }
+    return borrow;
+}
+
+#endif //CPUSTORAGE_LIMBACCESSIBLE_INL
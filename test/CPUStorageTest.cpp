@@ -3,6 +3,8 @@
 //
 #include <gtest/gtest.h>
 #include <storage/cpu-storage/CPUStorage.h>
+#include <concepts/StorageProvider.h>
+#include <memory_resource>
 
 TEST(CPUStorageTest, OffsetAddAndSub) {
     // Test OffsetAdd(offset, bitWidth, value)
@@ -126,6 +128,41 @@ TEST(CPUStorageTest, OffsetAddWithCarryAndSubWithBorrow) {
     ASSERT_TRUE(result8.second); // Borrow should be true
 }
 
+TEST(CPUStorageTest, OffsetAddAndSubAcrossLimbs) {
+    // 130-bit range starting at bit 3: spans three limbs with a masked tail
+    CPUStorage<20> storage;
+    storage.data_.fill(0xFF);
+    CPUStorage<20> one;
+    one.data_[0] = 0x08; // 1 << 3
+    auto [sum, carry] = storage.OffsetAddWithCarry(one, 0, 133, 0, false);
+    ASSERT_TRUE(carry);
+    ASSERT_EQ(sum.data_[0], 0x07); // Bits below the offset are untouched
+    for (size_t i = 1; i < 16; ++i) {
+        ASSERT_EQ(sum.data_[i], 0x00);
+    }
+    ASSERT_EQ(sum.data_[16], 0xE0); // Bits 128..132 wrapped to zero, bits 133..135 untouched
+    ASSERT_EQ(sum.data_[17], 0xFF);
+
+    auto [difference, borrow] = sum.OffsetSubWithBorrow(one, 0, 133, 0, false);
+    ASSERT_TRUE(borrow);
+    ASSERT_EQ(difference.data_, storage.data_);
+
+    // Source and destination at different bit offsets
+    CPUStorage<16> destination;
+    CPUStorage<16> source;
+    source.data_.fill(0xFF);
+    destination.OffsetAdd(source, 5, 100, 9);
+    destination.OffsetAdd(source, 5, 100, 9);
+    ASSERT_TRUE(destination.TestBitRange(0, 10, false)); // (2^100 - 1) * 2 keeps bit 9 clear
+    ASSERT_TRUE(destination.TestBitRange(10, 99, true));
+    ASSERT_TRUE(destination.TestBitRange(109, 19, false));
+
+    destination.OffsetSub(10, 99, 1); // 2^99 - 1 becomes 2^99 - 2
+    ASSERT_TRUE(destination.TestBitRange(0, 11, false));
+    ASSERT_TRUE(destination.TestBitRange(11, 98, true));
+    ASSERT_TRUE(destination.TestBitRange(109, 19, false));
+}
+
 TEST(CPUStorageTest, BitAccessible) {
     CPUStorage<1> storage;
 
@@ -457,6 +494,89 @@ TEST(CPUStorageTest, BitManipulable) {
     ASSERT_EQ(storage.data_[0], 0xFE);
 }
 
+TEST(CPUStorageTest, ShiftAndRotateRanges) {
+    // Against a bit-by-bit reference over ranges that start and end inside limbs
+    auto reference = [](const CPUStorage<37>& input, size_t start, size_t count, size_t positions, bool left, bool rotate) {
+        CPUStorage<37> expected = input;
+        for (size_t j = 0; j < count; ++j) {
+            bool bit = false;
+            if (rotate) {
+                const size_t shift = positions % count;
+                bit = input.GetBit(start + (left ? (j + count - shift) % count : (j + shift) % count));
+            }
+            else if (left ? j >= positions : j + positions < count) {
+                bit = input.GetBit(start + (left ? j - positions : j + positions));
+            }
+            expected.SetBit(start + j, bit);
+        }
+        return expected;
+    };
+
+    CPUStorage<37> input;
+    uint32_t state = 0x12345678;
+    for (size_t i = 0; i < 37; ++i) {
+        state = state * 1664525u + 1013904223u;
+        input.data_[i] = static_cast<uint8_t>(state >> 24);
+    }
+
+    for (size_t start : { size_t{0}, size_t{3}, size_t{61} }) {
+        for (size_t count : { size_t{1}, size_t{64}, size_t{130}, 296 - start - 3 }) {
+            for (size_t positions : { 0u, 1u, 7u, 64u, 65u, 129u, 400u }) {
+                CPUStorage<37> storage = input;
+                storage.ShiftRangeLeft(start, count, positions);
+                ASSERT_EQ(storage.data_, reference(input, start, count, positions, true, false).data_);
+                storage = input;
+                storage.ShiftRangeRight(start, count, positions);
+                ASSERT_EQ(storage.data_, reference(input, start, count, positions, false, false).data_);
+                storage = input;
+                storage.RotateRangeLeft(start, count, positions);
+                ASSERT_EQ(storage.data_, reference(input, start, count, positions, true, true).data_);
+                storage = input;
+                storage.RotateRangeRight(start, count, positions);
+                ASSERT_EQ(storage.data_, reference(input, start, count, positions, false, true).data_);
+            }
+        }
+    }
+
+    // Whole-storage variants shift everything out past the end
+    CPUStorage<37> storage = input;
+    storage.ShiftLeft(296);
+    ASSERT_TRUE(storage.IsAllZeros());
+    storage = input;
+    storage.RotateLeft(296 + 5);
+    storage.RotateRight(5);
+    ASSERT_EQ(storage.data_, input.data_);
+}
+
+TEST(CPUStorageTest, ReverseBitRanges) {
+    CPUStorage<512> input;
+    uint32_t state = 0x9E3779B9;
+    for (size_t i = 0; i < 512; ++i) {
+        state = state * 1664525u + 1013904223u;
+        input.data_[i] = static_cast<uint8_t>(state >> 24);
+    }
+
+    for (size_t start : { size_t{0}, size_t{5}, size_t{64}, size_t{1000} }) {
+        for (size_t count : { size_t{2}, size_t{63}, size_t{64}, size_t{65}, size_t{300}, 4096 - start }) {
+            CPUStorage<512> storage = input;
+            storage.ReverseBitRange(start, count);
+            CPUStorage<512> expected = input;
+            for (size_t j = 0; j < count; ++j) {
+                expected.SetBit(start + j, input.GetBit(start + count - 1 - j));
+            }
+            ASSERT_EQ(storage.data_, expected.data_);
+        }
+    }
+
+    // A whole 4096-bit block reversed twice comes back unchanged
+    CPUStorage<512> storage = input;
+    storage.ReverseBits();
+    ASSERT_EQ(storage.GetBit(0), input.GetBit(4095));
+    ASSERT_EQ(storage.GetBit(4095), input.GetBit(0));
+    storage.ReverseBits();
+    ASSERT_EQ(storage.data_, input.data_);
+}
+
 TEST(CPUStorageTest, ByteAccessible) {
     CPUStorage<4> storage;
     storage[0] = 0x11;
@@ -519,6 +639,37 @@ TEST(CPUStorageTest, ByteAnalyzable) {
     // Equal
     ASSERT_TRUE(storage.Equal(same));
     ASSERT_FALSE(storage.Equal(different));
+
+    // Checksums
+    ASSERT_EQ(storage.ComputeHash(), same.ComputeHash());
+    ASSERT_NE(storage.ComputeHash(), different.ComputeHash());
+    ASSERT_NE(storage.ComputeCRC32(), different.ComputeCRC32());
+}
+
+TEST(CPUStorageTest, Checksums) {
+    // CRC32C check value
+    CPUStorage<9> check;
+    const char* digits = "123456789";
+    std::memcpy(check.data_.data(), digits, 9);
+    ASSERT_EQ(check.ComputeCRC32(), 0xE3069283u);
+
+    // Every length up to a few hash lanes, one flipped bit at a time
+    CPUStorage<200> storage;
+    for (size_t i = 0; i < 200; ++i) {
+        storage[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    const uint32_t crc = storage.ComputeCRC32();
+    const uint64_t hash = storage.ComputeHash();
+    ASSERT_EQ(crc, LimbCrc32c(storage.data_.data() + 100, 100, LimbCrc32c(storage.data_.data(), 100)));
+    for (size_t bit = 0; bit < 1600; bit += 7) {
+        storage.FlipBit(bit);
+        ASSERT_NE(storage.ComputeCRC32(), crc);
+        ASSERT_NE(storage.ComputeHash(), hash);
+        storage.FlipBit(bit);
+    }
+    for (size_t length = 0; length < 64; ++length) {
+        ASSERT_NE(LimbHashBytes(storage.data_.data(), length), LimbHashBytes(storage.data_.data(), length + 1));
+    }
 }
 
 TEST(CPUStorageTest, ByteCopyable) {
@@ -666,6 +817,72 @@ TEST(CPUStorageTest, ByteManipulable) {
     ASSERT_EQ(s1[0], 0x00);
 }
 
+TEST(CPUStorageTest, LimbLayout) {
+    static_assert(StorageProvider<CPULimbStorageProvider, 5>);
+    static_assert(StorageProvider<CPULimbStorageProvider, 64>);
+    static_assert(CPUStorage<5, CPULimbLayout>::dataAlignment == 64);
+
+    CPUStorage<5, CPULimbLayout> storage;
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(storage.Data()) % 64, 0u);
+    ASSERT_EQ(storage.GetByteSize(), 5u);
+    ASSERT_TRUE(storage.IsAllZeros());
+
+    // Byte view and limb view share the same memory; padding stays zero
+    storage.Fill(0xFF);
+    ASSERT_TRUE(storage.IsAllOnes());
+    ASSERT_EQ(storage.data_.limbs()[0], 0xFFFFFFFFFFull);
+
+    storage.OffsetAdd(0, 40, 1);
+    ASSERT_TRUE(storage.IsAllZeros());
+    ASSERT_EQ(storage.data_.limbs()[0], 0u);
+
+    // Cross-layout copies
+    CPUStorage<5> bytes;
+    bytes.data_ = { 0x12, 0x34, 0x56, 0x78, 0x9A };
+    storage.CopyBytesFrom(bytes, 0, 5, 0);
+    ASSERT_TRUE(storage.Equal(std::span<const uint8_t>(bytes.data_)));
+    CPUStorage<5, CPULimbLayout> copy = storage;
+    copy.ReverseBytes();
+    ASSERT_EQ(copy[0], 0x9A);
+    ASSERT_EQ(copy.data_.limbs()[0], 0x123456789Aull);
+}
+
+TEST(CPUStorageTest, HeapLayout) {
+    using HeapStorage = CPUStorage<8192, CPUHeapLayout<>>;
+    static_assert(StorageProvider<CPUHeapStorageProvider<>, 8192>);
+    static_assert(StorageProvider<CPUHeapStorageProvider<std::allocator<Limb>>, 5>);
+    static_assert(sizeof(HeapStorage) < 64);
+    // Moves are pointer steals, so containers move rather than copy on reallocation
+    static_assert(std::is_nothrow_move_constructible_v<HeapStorage>);
+
+    // Limbs come from whatever arena is plugged in
+    std::array<std::byte, 32768> arena;
+    std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(), std::pmr::null_memory_resource());
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&resource);
+    HeapStorage storage;
+    std::pmr::set_default_resource(previous);
+    const auto* address = reinterpret_cast<const std::byte*>(storage.Data());
+    ASSERT_TRUE(address >= arena.data() && address < arena.data() + arena.size());
+    ASSERT_TRUE(storage.IsAllZeros());
+
+    storage.SetBit(65535);
+    storage.OffsetAdd(0, 65535, 12345);
+
+    // Moves steal the pointer, copies are deep
+    HeapStorage moved = std::move(storage);
+    ASSERT_EQ(reinterpret_cast<const std::byte*>(moved.Data()), address);
+    HeapStorage copy = moved;
+    ASSERT_NE(copy.Data(), moved.Data());
+    ASSERT_TRUE(copy.Equal(moved));
+    ASSERT_TRUE(copy.GetBit(65535));
+    ASSERT_EQ(copy.LoadLimb(0), 12345u);
+
+    storage = copy;
+    copy.ClearAllBits();
+    ASSERT_TRUE(storage.Equal(moved));
+    ASSERT_TRUE(copy.IsAllZeros());
+}
+
 TEST(CPUStorageTest, Miscellaneous) {
     // Test Clone
     CPUStorage<4> storage1;
@@ -0,0 +1,113 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+#include <gtest/gtest.h>
+#include <core/dynamic-unsigned-int/DynamicUnsignedInt.h>
+#include <core/dynamic-signed-int/DynamicSignedInt.h>
+#include <storage/cpu-storage/CPUStorage.h>
+#include <unordered_set>
+
+TEST(DynamicUnsignedIntTest, Constructors) {
+    ASSERT_THROW(DynamicUnsignedInt(0), std::invalid_argument);
+
+    DynamicUnsignedInt a(100);
+    ASSERT_TRUE(a.IsZero());
+    ASSERT_EQ(a.GetBitSize(), 100u);
+    ASSERT_EQ(a.GetLimbCount(), 2u);
+
+    DynamicUnsignedInt b(12, 0xABCDu);
+    ASSERT_EQ(b.ToString(), "3021"); // 0xBCD
+    ASSERT_EQ(b.ToHexString(), "BCD");
+
+    DynamicUnsignedInt c(8, "300");
+    ASSERT_EQ(c.ToString(), "44");
+    ASSERT_THROW(DynamicUnsignedInt(64, "12x"), std::invalid_argument);
+
+    DynamicUnsignedInt d(130, std::string(40, 'F'), 16);
+    ASSERT_EQ(d.ToString(16), "3" + std::string(32, 'F'));
+}
+
+TEST(DynamicUnsignedIntTest, MatchesFixedWidth) {
+    // 2048 bits is past the Karatsuba threshold, so both the basecase and the subquadratic products run
+    using UInt2048 = ArbitraryUnsignedInt<2048, 0, CPUStorageProvider>;
+    UInt2048 x("3");
+    UInt2048 y("7");
+    for (int i = 0; i < 9; ++i) {
+        x *= x;
+        x += UInt2048(i);
+        y = y * y * UInt2048(7);
+    }
+    const DynamicUnsignedInt dx(x);
+    const DynamicUnsignedInt dy(y);
+    ASSERT_EQ(dx.ToString(), x.ToString());
+    ASSERT_EQ((dx * dy).ToString(), (x * y).ToString());
+    ASSERT_EQ((dx + dy).ToString(), (UInt2048(x) + y).ToString());
+    ASSERT_EQ((dy - dx).ToString(), (UInt2048(y) - x).ToString());
+    ASSERT_EQ((dx / (dy >> 1500)).ToString(), (x / (y >> 1500)).ToString());
+    ASSERT_EQ((dx % (dy >> 1500)).ToString(), (x % (y >> 1500)).ToString());
+    ASSERT_EQ((dx << 777).ToString(), (x << 777).ToString());
+    ASSERT_EQ(dx.Hash(), x.Hash());
+
+    // Round trip through the fixed-width template, including a type stored at an offset
+    ASSERT_TRUE(static_cast<UInt2048>(dx * dy) == x * y);
+    using Offset = ArbitraryUnsignedInt<2048, 5, CPUStorageProvider>;
+    const Offset shifted = static_cast<Offset>(dx);
+    ASSERT_EQ(shifted.ToString(), x.ToString());
+    ASSERT_TRUE(DynamicUnsignedInt(shifted) == dx);
+    using UInt1024 = ArbitraryUnsignedInt<1024, 0, CPUStorageProvider>;
+    ASSERT_THROW(static_cast<UInt1024>(dx), std::invalid_argument);
+}
+
+TEST(DynamicUnsignedIntTest, RuntimeWidths) {
+    std::unordered_set<DynamicUnsignedInt> seen;
+    for (size_t bits : { 1024u, 2048u, 3072u, 4096u }) {
+        // 2^bits - 1 squared wraps to 1
+        const DynamicUnsignedInt max = ~DynamicUnsignedInt(bits);
+        ASSERT_EQ((max * max).ToString(), "1");
+        ASSERT_TRUE(max + DynamicUnsignedInt(bits, 1) == DynamicUnsignedInt(bits));
+        ASSERT_TRUE((max >> (bits - 1)) == DynamicUnsignedInt(bits, 1));
+        ASSERT_TRUE(max > DynamicUnsignedInt(bits, 1));
+        const auto [quotient, remainder] = max.DivRem(DynamicUnsignedInt(bits, 1000));
+        ASSERT_TRUE(quotient * DynamicUnsignedInt(bits, 1000) + remainder == max);
+        seen.insert(max);
+    }
+    ASSERT_EQ(seen.size(), 4u);
+    ASSERT_FALSE(DynamicUnsignedInt(64, 1) == DynamicUnsignedInt(65, 1));
+
+    ASSERT_THROW(DynamicUnsignedInt(64, 1) + DynamicUnsignedInt(65, 1), std::invalid_argument);
+    ASSERT_THROW(DynamicUnsignedInt(64, 1) / DynamicUnsignedInt(64), std::runtime_error);
+    ASSERT_EQ(DynamicUnsignedInt(200, 0x1234).Resized(8).ToString(), "52");
+    ASSERT_EQ(DynamicUnsignedInt(8, 0xFF).Resized(600).ToString(), "255");
+}
+
+TEST(DynamicSignedIntTest, Arithmetic) {
+    DynamicSignedInt a(100, -7);
+    DynamicSignedInt b(100, 2);
+    ASSERT_EQ(a.ToString(), "-7");
+    ASSERT_EQ((a / b).ToString(), "-3");
+    ASSERT_EQ((a % b).ToString(), "-1");
+    ASSERT_EQ((a * b).ToString(), "-14");
+    ASSERT_EQ((a >> 1).ToString(), "-4");
+    ASSERT_EQ((-a).ToString(), "7");
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(-b > a);
+    ASSERT_EQ(DynamicSignedInt(100, "-633825300114114700748351602688").ToString(), "-633825300114114700748351602688"); // -2^99
+    ASSERT_EQ(DynamicSignedInt(100, "633825300114114700748351602688").ToString(), "-633825300114114700748351602688");
+    ASSERT_EQ(DynamicSignedInt(8, -1).ToHexString(), "FF");
+    ASSERT_EQ(a.Resized(300).ToString(), "-7");
+    ASSERT_EQ(DynamicSignedInt(16, 200).Resized(8).ToString(), "-56");
+}
+
+TEST(DynamicSignedIntTest, MatchesFixedWidth) {
+    using Int300 = ArbitrarySignedInt<300, 3, CPUStorageProvider>;
+    const Int300 x("-123456789012345678901234567890123456789012345678901234567890");
+    const Int300 y("98765432109876543210987654321");
+    const DynamicSignedInt dx(x);
+    const DynamicSignedInt dy(y);
+    ASSERT_EQ(dx.ToString(), x.ToString());
+    ASSERT_EQ((dx * dy).ToString(), (x * y).ToString());
+    ASSERT_EQ((dx / dy).ToString(), (x / y).ToString());
+    ASSERT_EQ((dx % dy).ToString(), (x % y).ToString());
+    ASSERT_EQ(dx.Hash(), x.Hash());
+    ASSERT_TRUE(static_cast<Int300>(dx - dy) == x - y);
+}
@@ -0,0 +1,450 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+#include <gtest/gtest.h>
+#include <core/float/ArbitraryFloat.h>
+#include <core/float/ArbitraryFloatBatch.h>
+#include <storage/cpu-storage/CPUStorage.h>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    using Float32Cpu = Float32<CPUStorageProvider>;
+    using Float64Cpu = Float64<CPUStorageProvider>;
+
+    // Native values and ArbitraryFloat share the little-endian IEEE 754 layout
+    template<typename Float, typename Native>
+    Float FromNative(Native value) {
+        return Float::FromLeBytes(std::bit_cast<std::array<uint8_t, sizeof(Native)>>(value));
+    }
+
+    template<typename Native, typename Float>
+    Native ToNative(const Float& value) {
+        return std::bit_cast<Native>(value.ToLeBytes());
+    }
+
+    // Bit-exact against the hardware, except that any NaN matches any NaN
+    template<typename Native, typename Float>
+    void ExpectSameAsNative(Native expected, const Float& actual) {
+        const Native value = ToNative<Native>(actual);
+        if (expected != expected) {
+            EXPECT_TRUE(value != value);
+            return;
+        }
+        using Bytes = std::array<uint8_t, sizeof(Native)>;
+        EXPECT_EQ(std::bit_cast<Bytes>(value), std::bit_cast<Bytes>(expected));
+    }
+
+    template<typename Float, typename Native>
+    void ExpectAllOpsMatch(Native a, Native b) {
+        const Float x = FromNative<Float>(a);
+        const Float y = FromNative<Float>(b);
+        ExpectSameAsNative(a + b, x + y);
+        ExpectSameAsNative(a - b, x - y);
+        ExpectSameAsNative(a * b, x * y);
+        ExpectSameAsNative(a / b, x / y);
+    }
+
+    // Bit-exact, except that any NaN matches any NaN
+    template<typename Float>
+    void ExpectSameEncoding(const Float& expected, const Float& actual) {
+        ASSERT_EQ(actual.IsNaN(), expected.IsNaN());
+        if (!expected.IsNaN()) {
+            ASSERT_EQ(actual.ToLeBytes(), expected.ToLeBytes());
+        }
+    }
+
+    // Every pair of encodings of a format small enough for the operator tables, against the double
+    // result rounded into the format. Sums and products are exact in a double, and a 53-bit quotient
+    // is wide enough that rounding it twice cannot change a 4-bit significand
+    template<typename Float>
+    void ExpectTablesMatchDouble() {
+        constexpr size_t count = size_t{1} << Float::TotalBits();
+        const auto decode = [](size_t bits) {
+            return Float::FromLeBytes(std::bit_cast<std::array<uint8_t, 1>>(static_cast<uint8_t>(bits)));
+        };
+        for (size_t i = 0; i < count; ++i) {
+            const Float x = decode(i);
+            const double a = static_cast<double>(x);
+            for (size_t j = 0; j < count; ++j) {
+                const Float y = decode(j);
+                const double b = static_cast<double>(y);
+                ExpectSameEncoding(Float(a + b), x + y);
+                ExpectSameEncoding(Float(a - b), x - y);
+                ExpectSameEncoding(Float(a * b), x * y);
+                ExpectSameEncoding(Float(a / b), x / y);
+            }
+        }
+    }
+
+    // The span operations against the scalar operators, bit for bit and NaNs included, on random
+    // encodings with cancelling sums and invalid operations mixed in. 1003 elements leave a tail
+    // after every SIMD and chunk width
+    template<typename Float>
+    void ExpectBatchMatchesScalar(uint64_t seed) {
+        constexpr size_t bytes = (Float::TotalBits() + 7) / 8;
+        std::mt19937_64 rng(seed);
+        const auto random = [&rng] {
+            std::array<uint8_t, bytes> encoding;
+            for (uint8_t& byte : encoding) {
+                byte = static_cast<uint8_t>(rng());
+            }
+            return Float::FromLeBytes(encoding);
+        };
+        constexpr size_t count = 1003;
+        const std::array<Float, 6> specials = { Float::Infinity(), Float::NegativeInfinity(), Float::Zero(),
+                                                Float::NegativeZero(), Float::QuietNaN(), Float::SignalingNaN() };
+        std::vector<Float> a(count), b(count), c(count);
+        for (size_t i = 0; i < count; ++i) {
+            a[i] = i % 3 == 0 ? specials[rng() % specials.size()] : random();
+            b[i] = i % 7 == 0 ? a[i] : i % 4 == 0 ? specials[rng() % specials.size()] : random();
+            c[i] = i % 5 == 0 ? -(a[i] * b[i]) : i % 2 == 0 ? specials[rng() % specials.size()] : random();
+        }
+        std::vector<Float> sum(count), difference(count), product(count), quotient(count), fused(count);
+        Add(std::span<const Float>(a), std::span<const Float>(b), std::span<Float>(sum));
+        Sub(std::span<const Float>(a), std::span<const Float>(b), std::span<Float>(difference));
+        Mul(std::span<const Float>(a), std::span<const Float>(b), std::span<Float>(product));
+        Div(std::span<const Float>(a), std::span<const Float>(b), std::span<Float>(quotient));
+        Fma(std::span<const Float>(a), std::span<const Float>(b), std::span<const Float>(c), std::span<Float>(fused));
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(sum[i].ToLeBytes(), (a[i] + b[i]).ToLeBytes());
+            ASSERT_EQ(difference[i].ToLeBytes(), (a[i] - b[i]).ToLeBytes());
+            ASSERT_EQ(product[i].ToLeBytes(), (a[i] * b[i]).ToLeBytes());
+            ASSERT_EQ(quotient[i].ToLeBytes(), (a[i] / b[i]).ToLeBytes());
+            ASSERT_EQ(fused[i].ToLeBytes(), a[i].Fma(b[i], c[i]).ToLeBytes());
+        }
+
+        // The output may alias an input
+        Mul(std::span<const Float>(a), std::span<const Float>(b), std::span<Float>(a));
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(a[i].ToLeBytes(), product[i].ToLeBytes());
+        }
+    }
+}
+
+TEST(ArbitraryFloatTest, SpecialValuesAndQueries) {
+    ExpectSameAsNative(std::numeric_limits<float>::infinity(), Float32Cpu::Infinity());
+    ExpectSameAsNative(-std::numeric_limits<double>::infinity(), Float64Cpu::NegativeInfinity());
+    ExpectSameAsNative(1.0f, Float32Cpu::One());
+    ExpectSameAsNative(std::numeric_limits<double>::max(), Float64Cpu::MaxValue());
+    ExpectSameAsNative(std::numeric_limits<double>::min(), Float64Cpu::MinValue());
+    ExpectSameAsNative(std::numeric_limits<double>::epsilon(), Float64Cpu::Epsilon());
+    ExpectSameAsNative(std::numeric_limits<float>::denorm_min(), Float32Cpu::MinSubnormal());
+    ExpectSameAsNative(-0.0f, Float32Cpu::NegativeZero());
+
+    ASSERT_TRUE(Float32Cpu::QuietNaN().IsNaN());
+    ASSERT_TRUE(Float32Cpu::SignalingNaN().IsNaN());
+    ASSERT_TRUE(Float32Cpu::Infinity().IsInf());
+    ASSERT_FALSE(Float32Cpu::Infinity().IsFinite());
+    ASSERT_TRUE(Float32Cpu::MinSubnormal().IsSubnormal());
+    ASSERT_TRUE(Float32Cpu::MinValue().IsNormal());
+    ASSERT_TRUE(Float32Cpu::NegativeZero().IsZero());
+    ASSERT_TRUE(Float32Cpu::NegativeZero().SignBit());
+    ASSERT_EQ((-Float32Cpu::One()).Sign(), -1);
+    ASSERT_EQ(Float32Cpu::Zero().Sign(), 0);
+}
+
+TEST(ArbitraryFloatTest, ArithmeticMatchesHardware) {
+    const float inf = std::numeric_limits<float>::infinity();
+    const float tiny = std::numeric_limits<float>::denorm_min();
+    const float values[] = {0.0f, -0.0f, 1.0f, -1.5f, 3.0f, 0.1f, 1e30f, -1e-30f, tiny, -3 * tiny,
+                            std::numeric_limits<float>::min(), std::numeric_limits<float>::max(), inf, -inf,
+                            std::numeric_limits<float>::quiet_NaN()};
+    for (float a : values) {
+        for (float b : values) {
+            ExpectAllOpsMatch<Float32Cpu>(a, b);
+        }
+    }
+
+    // Ties round to even: 1 + 2^-24 stays at 1, 1 + 3 * 2^-24 rounds up
+    ExpectAllOpsMatch<Float32Cpu>(1.0f, std::ldexp(1.0f, -24));
+    ExpectAllOpsMatch<Float32Cpu>(1.0f, std::ldexp(3.0f, -24));
+    // Overflow to infinity and gradual underflow into subnormals
+    ExpectAllOpsMatch<Float64Cpu>(std::numeric_limits<double>::max(), 2.0);
+    ExpectAllOpsMatch<Float64Cpu>(std::numeric_limits<double>::min(), 3.0);
+    ExpectAllOpsMatch<Float64Cpu>(0x1.fffffffffffffp-1023, 0x1p-52);
+}
+
+TEST(ArbitraryFloatTest, RandomArithmeticMatchesHardware) {
+    // Random bit patterns hit every exponent, including subnormals, infinities and NaNs
+    std::mt19937_64 rng(2025);
+    for (int i = 0; i < 20000; ++i) {
+        const uint64_t bits = rng();
+        ExpectAllOpsMatch<Float32Cpu>(std::bit_cast<float>(static_cast<uint32_t>(bits)), std::bit_cast<float>(static_cast<uint32_t>(bits >> 32)));
+        // Nearby exponents exercise cancellation and the sticky bit
+        const uint64_t a = rng();
+        ExpectAllOpsMatch<Float64Cpu>(std::bit_cast<double>(a), std::bit_cast<double>(a ^ (rng() >> (rng() % 64))));
+    }
+}
+
+TEST(ArbitraryFloatTest, SoftFloatMatchesCompilerTypes) {
+    // float and double formats take the FPU path, so check the soft-float core bit for bit
+    // against the compiler's own half and quad precision types where it has them
+    std::mt19937_64 rng(17);
+#if defined(__FLT16_MAX__)
+    using Float16Cpu = Float16<CPUStorageProvider>;
+    for (int i = 0; i < 20000; ++i) {
+        const uint64_t bits = rng();
+        ExpectAllOpsMatch<Float16Cpu>(std::bit_cast<_Float16>(static_cast<uint16_t>(bits)), std::bit_cast<_Float16>(static_cast<uint16_t>(bits >> 16)));
+    }
+#endif
+#if defined(__SIZEOF_FLOAT128__) && defined(__x86_64__)
+    using Float128Cpu = Float128<CPUStorageProvider>;
+    for (int i = 0; i < 5000; ++i) {
+        const std::array<uint64_t, 2> a = {rng(), rng()};
+        // Flip a few low bits of b now and then to get nearby operands and deep cancellation
+        const std::array<uint64_t, 2> b = i % 4 == 0 ? std::array<uint64_t, 2>{a[0] ^ (rng() % 16), a[1]} : std::array<uint64_t, 2>{rng(), rng()};
+        ExpectAllOpsMatch<Float128Cpu>(std::bit_cast<__float128>(a), std::bit_cast<__float128>(b));
+    }
+#endif
+    SUCCEED();
+}
+
+TEST(ArbitraryFloatTest, WideFormats) {
+    using Float128Cpu = Float128<CPUStorageProvider>;
+    using Float256Cpu = Float256<CPUStorageProvider>;
+
+    // 1/3 * 3 is exactly 1 in binary128: 0x1.555...5p-2 * 3 = 1 - 2^-114 rounds up to 1
+    const Float128Cpu one = Float128Cpu::One();
+    const Float128Cpu three = one + one + one;
+    ASSERT_EQ(((one / three) * three).ToLeBytes(), one.ToLeBytes());
+    ASSERT_EQ((three - one - one - one).ToLeBytes(), Float128Cpu::Zero().ToLeBytes());
+
+    // 1 + epsilon is representable, 1 + epsilon / 2 ties back to 1
+    const Float256Cpu unit = Float256Cpu::One();
+    const Float256Cpu epsilon = Float256Cpu::Epsilon();
+    ASSERT_NE((unit + epsilon).ToLeBytes(), unit.ToLeBytes());
+    ASSERT_EQ((unit + epsilon / (unit + unit)).ToLeBytes(), unit.ToLeBytes());
+    ASSERT_EQ((unit + epsilon - unit).ToLeBytes(), epsilon.ToLeBytes());
+
+    // Halving the smallest normal lands in the subnormal range and back again exactly
+    const Float128Cpu half = one / (one + one);
+    const Float128Cpu subnormal = Float128Cpu::MinValue() * half;
+    ASSERT_TRUE(subnormal.IsSubnormal());
+    ASSERT_EQ((subnormal + subnormal).ToLeBytes(), Float128Cpu::MinValue().ToLeBytes());
+    ASSERT_TRUE((Float128Cpu::MaxValue() * three).IsInf());
+
+    Float128Cpu accumulator = one;
+    accumulator += one;
+    accumulator *= three;
+    accumulator -= one;
+    accumulator /= (one + one + one + one + one);
+    ASSERT_EQ(accumulator.ToLeBytes(), one.ToLeBytes());
+}
+
+TEST(ArbitraryFloatTest, FormatConversions) {
+    using Float128Cpu = Float128<CPUStorageProvider>;
+    using Float16Cpu = Float16<CPUStorageProvider>;
+
+    // Widening is exact and narrowing rounds like the hardware does
+    std::mt19937_64 rng(31);
+    for (int i = 0; i < 20000; ++i) {
+        const double value = std::bit_cast<double>(rng());
+        const Float64Cpu wide(value);
+        ExpectSameAsNative(value, wide);
+        ExpectSameAsNative(static_cast<float>(value), static_cast<Float32Cpu>(wide));
+        ExpectSameAsNative(static_cast<float>(value), Float32Cpu(value));
+        ExpectSameAsNative(static_cast<float>(value), Float32Cpu(static_cast<float>(value)));
+        ExpectSameAsNative(value, static_cast<Float64Cpu>(static_cast<Float128Cpu>(wide)));
+        ExpectSameAsNative(static_cast<double>(static_cast<float>(value)), static_cast<Float64Cpu>(Float32Cpu(value)));
+        if (value == value) {
+            ASSERT_EQ(static_cast<double>(wide), value);
+        }
+    }
+
+    // 65520 is halfway between the largest half and the next power of two, so it ties up to infinity
+    ASSERT_TRUE(Float16Cpu(65519.0f).IsFinite());
+    ASSERT_TRUE(Float16Cpu(65520.0f).IsInf());
+    ASSERT_EQ(static_cast<float>(Float16Cpu(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+    ASSERT_TRUE(Float16Cpu(std::ldexp(1.0f, -25)).IsZero());
+    ASSERT_FALSE(Float16Cpu(std::ldexp(1.5f, -25)).IsZero());
+    ASSERT_TRUE(Float16Cpu(std::numeric_limits<float>::quiet_NaN()).IsNaN());
+}
+
+TEST(ArbitraryFloatTest, ConvertArrayMatchesScalar) {
+    using Float16Cpu = Float16<CPUStorageProvider>;
+    using BFloat16Cpu = BFloat16<CPUStorageProvider>;
+
+    // Every half, through the batch kernel and back; lengths that are not a multiple of 8 cover the tails
+    std::vector<Float16Cpu> halves;
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        halves.push_back(Float16Cpu::FromLeBytes(std::bit_cast<std::array<uint8_t, 2>>(static_cast<uint16_t>(bits))));
+    }
+    halves.push_back(Float16Cpu::One());
+    std::vector<float> widened(halves.size());
+    ConvertArray(std::span<const Float16Cpu>(halves), std::span<float>(widened));
+    for (size_t i = 0; i < halves.size(); ++i) {
+        ExpectSameAsNative(static_cast<float>(halves[i]), FromNative<Float32Cpu>(widened[i]));
+    }
+    std::vector<Float16Cpu> narrowed(widened.size());
+    ConvertArray(std::span<const float>(widened), std::span<Float16Cpu>(narrowed));
+    for (size_t i = 0; i < halves.size(); ++i) {
+        // The round trip is exact for everything but signaling NaNs, which come back quiet
+        if (!halves[i].IsNaN()) {
+            ASSERT_EQ(narrowed[i].ToLeBytes(), halves[i].ToLeBytes());
+        }
+        ASSERT_EQ(narrowed[i].IsNaN(), halves[i].IsNaN());
+    }
+
+    // Random floats hit every rounding case for both 16-bit formats
+    std::mt19937_64 rng(43);
+    std::vector<float> values(20003);
+    for (float& value : values) {
+        value = std::bit_cast<float>(static_cast<uint32_t>(rng()));
+    }
+    std::vector<Float16Cpu> half(values.size());
+    std::vector<BFloat16Cpu> brain(values.size());
+    ConvertArray(std::span<const float>(values), std::span<Float16Cpu>(half));
+    ConvertArray(std::span<const float>(values), std::span<BFloat16Cpu>(brain));
+    std::vector<float> fromBrain(values.size());
+    ConvertArray(std::span<const BFloat16Cpu>(brain), std::span<float>(fromBrain));
+    for (size_t i = 0; i < values.size(); ++i) {
+        const Float16Cpu expectedHalf(values[i]);
+        const BFloat16Cpu expectedBrain(values[i]);
+        ASSERT_EQ(half[i].IsNaN(), expectedHalf.IsNaN());
+        ASSERT_EQ(brain[i].IsNaN(), expectedBrain.IsNaN());
+        if (!expectedHalf.IsNaN()) {
+            ASSERT_EQ(half[i].ToLeBytes(), expectedHalf.ToLeBytes());
+        }
+        if (!expectedBrain.IsNaN()) {
+            ASSERT_EQ(brain[i].ToLeBytes(), expectedBrain.ToLeBytes());
+            ExpectSameAsNative(static_cast<float>(expectedBrain), FromNative<Float32Cpu>(fromBrain[i]));
+        }
+    }
+#if defined(__FLT16_MAX__)
+    for (size_t i = 0; i < values.size(); ++i) {
+        ExpectSameAsNative(static_cast<_Float16>(values[i]), half[i]);
+    }
+#endif
+
+    std::vector<float> wrongSize(3);
+    ASSERT_THROW(ConvertArray(std::span<const Float16Cpu>(halves), std::span<float>(wrongSize)), std::invalid_argument);
+}
+
+TEST(ArbitraryFloatTest, TinyFormatsUseLookupTables) {
+    ExpectTablesMatchDouble<ArbitraryFloat<4, 3, CPUStorageProvider>>(); // FP8 E4M3 (IEEE-style, with infinities)
+    ExpectTablesMatchDouble<ArbitraryFloat<5, 2, CPUStorageProvider>>(); // FP8 E5M2
+    ExpectTablesMatchDouble<ArbitraryFloat<2, 1, CPUStorageProvider>>();
+    ExpectTablesMatchDouble<ArbitraryFloat<3, 2, CPUStorageProvider>>();
+
+    // A 12-bit format decodes through its table: check every encoding against the field formula
+    using Float12 = ArbitraryFloat<5, 6, CPUStorageProvider>;
+    for (uint32_t bits = 0; bits < 4096; ++bits) {
+        const Float12 value = Float12::FromLeBytes(std::bit_cast<std::array<uint8_t, 2>>(static_cast<uint16_t>(bits)));
+        const int exponent = static_cast<int>(bits >> 6 & 0x1F);
+        const double magnitude = exponent == 0 ? std::ldexp(static_cast<double>(bits & 0x3F), -20)
+                                               : std::ldexp(static_cast<double>(64 | (bits & 0x3F)), exponent - 21);
+        const double expected = (bits & 0x800) != 0 ? -magnitude : magnitude;
+        if (exponent == 0x1F) {
+            ASSERT_EQ(std::isnan(static_cast<double>(value)), (bits & 0x3F) != 0);
+            continue;
+        }
+        ASSERT_EQ(std::bit_cast<uint64_t>(static_cast<double>(value)), std::bit_cast<uint64_t>(expected));
+        ASSERT_EQ(static_cast<float>(value), static_cast<float>(expected));
+    }
+}
+
+TEST(ArbitraryFloatTest, FusedMultiplyAdd) {
+    // A 68-bit format with a double's precision rounds like std::fma whenever the result is a normal double
+    using WideDouble = ArbitraryFloat<15, 52, CPUStorageProvider>;
+    std::mt19937_64 rng(47);
+    std::uniform_real_distribution<double> significand(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-60, 60);
+    for (int i = 0; i < 20000; ++i) {
+        const double x = std::ldexp(significand(rng), exponent(rng));
+        const double y = std::ldexp(significand(rng), exponent(rng));
+        // Every fourth addend cancels the leading bits of the product
+        const double z = i % 4 == 0 ? -(x * y) : std::ldexp(significand(rng), exponent(rng));
+        const double expected = std::fma(x, y, z);
+        const WideDouble result = WideDouble(x).Fma(WideDouble(y), WideDouble(z));
+        ASSERT_EQ(std::bit_cast<uint64_t>(static_cast<double>(result)), std::bit_cast<uint64_t>(expected));
+        ASSERT_EQ(std::bit_cast<uint64_t>(static_cast<double>(WideDouble(x).Fms(WideDouble(y), WideDouble(z)))), std::bit_cast<uint64_t>(std::fma(x, y, -z)));
+        ExpectSameAsNative(std::fma(x, y, z), FromNative<Float64Cpu>(x).Fma(FromNative<Float64Cpu>(y), FromNative<Float64Cpu>(z)));
+    }
+
+    const WideDouble infinity = WideDouble::Infinity();
+    EXPECT_TRUE(infinity.Fma(WideDouble::Zero(), WideDouble::One()).IsNaN());
+    EXPECT_TRUE(infinity.Fma(WideDouble::One(), -infinity).IsNaN());
+    EXPECT_TRUE(WideDouble::One().Fma(WideDouble::One(), -WideDouble::One()).IsZero());
+}
+
+TEST(ArbitraryFloatTest, BatchArithmeticMatchesScalar) {
+    ExpectBatchMatchesScalar<Float16<CPUStorageProvider>>(51);       // float lanes
+    ExpectBatchMatchesScalar<BFloat16<CPUStorageProvider>>(52);      // float lanes
+    ExpectBatchMatchesScalar<ArbitraryFloat<6, 9, CPUStorageProvider>>(53);   // double lanes
+    ExpectBatchMatchesScalar<ArbitraryFloat<8, 15, CPUStorageProvider>>(54);  // double lanes
+    ExpectBatchMatchesScalar<ArbitraryFloat<10, 21, CPUStorageProvider>>(55); // double lanes
+    ExpectBatchMatchesScalar<ArbitraryFloat<4, 3, CPUStorageProvider>>(56);   // lookup tables
+    ExpectBatchMatchesScalar<Float32Cpu>(57);                        // FPU
+    ExpectBatchMatchesScalar<ArbitraryFloat<15, 48, CPUStorageProvider>>(58); // soft-float core
+
+    std::vector<Float32Cpu> values(4), shorter(3);
+    ASSERT_THROW(Add(std::span<const Float32Cpu>(values), std::span<const Float32Cpu>(shorter), std::span<Float32Cpu>(values)), std::invalid_argument);
+    ASSERT_THROW(Fma(std::span<const Float32Cpu>(values), std::span<const Float32Cpu>(values), std::span<const Float32Cpu>(values), std::span<Float32Cpu>(shorter)), std::invalid_argument);
+}
+
+TEST(ArbitraryFloatTest, ComparisonAndHashing) {
+    using Half = ArbitraryFloat<5, 10, CPUStorageProvider>;
+    const auto fromBits = [](uint16_t bits) {
+        return Half::FromLeBytes(std::bit_cast<std::array<uint8_t, 2>>(bits));
+    };
+
+    // Every ordered pair of a sample of halves, against double
+    std::mt19937_64 rng(61);
+    for (int i = 0; i < 20000; ++i) {
+        const Half x = fromBits(static_cast<uint16_t>(rng()));
+        const Half y = i % 5 == 0 ? x : fromBits(static_cast<uint16_t>(rng()));
+        const double a = static_cast<double>(x);
+        const double b = static_cast<double>(y);
+        ASSERT_EQ(x == y, a == b);
+        ASSERT_EQ(x != y, a != b);
+        ASSERT_EQ(x < y, a < b);
+        ASSERT_EQ(x <= y, a <= b);
+        ASSERT_EQ(x > y, a > b);
+        ASSERT_EQ(x >= y, a >= b);
+        ASSERT_TRUE((x <=> y) == (a <=> b));
+        if (x == y) {
+            ASSERT_EQ(x.Hash(), y.Hash());
+        }
+    }
+
+    // +0 and -0 are equal and hash alike; every NaN hashes alike but equals nothing
+    ASSERT_TRUE(Half::Zero() == Half::NegativeZero());
+    ASSERT_EQ(Half::Zero().Hash(), Half::NegativeZero().Hash());
+    const std::array<Half, 5> nans = { fromBits(0x7E00), fromBits(0xFE00), fromBits(0x7C01), fromBits(0xFD55), Half::SignalingNaN() };
+    for (const Half& nan : nans) {
+        ASSERT_TRUE(nan.IsNaN());
+        ASSERT_EQ(nan.Hash(), Half::QuietNaN().Hash());
+        ASSERT_FALSE(nan == nan);
+        ASSERT_TRUE(nan != nan);
+        ASSERT_FALSE(nan < Half::One() || nan > Half::One() || nan <= nan || nan >= nan);
+    }
+    ASSERT_NE(Half::Zero().Hash(), Half::One().Hash());
+
+    std::unordered_set<Half> keys = { Half::Zero(), Half::One(), Half(2.5), Half(-0.125) };
+    ASSERT_EQ(keys.count(Half::NegativeZero()), 1u);
+    ASSERT_EQ(keys.count(Half(2.5)), 1u);
+    ASSERT_EQ(keys.count(-Half(0.125)), 1u);
+    ASSERT_EQ(keys.count(Half(3.0)), 0u);
+    keys.insert(Half::NegativeZero());
+    ASSERT_EQ(keys.size(), 4u);
+    keys.insert(Half::QuietNaN());
+    ASSERT_EQ(keys.count(Half::QuietNaN()), 0u);
+
+    // Mixed formats compare by value
+    using BFloat16Cpu = BFloat16<CPUStorageProvider>;
+    ASSERT_TRUE(Half(1.5) == BFloat16Cpu(1.5));
+    ASSERT_TRUE(Half(65504.0) < BFloat16Cpu(1e30));
+    ASSERT_TRUE(Half::NegativeZero() == Float32Cpu::Zero());
+    ASSERT_TRUE(Half(0.1) != Float32Cpu(0.1f));
+    ASSERT_TRUE((Half::QuietNaN() <=> Float32Cpu::One()) == std::partial_ordering::unordered);
+
+    // Native formats order like the hardware
+    ASSERT_TRUE(Float32Cpu(-1.0f) < Float32Cpu::NegativeZero());
+    ASSERT_TRUE(Float32Cpu::Zero() == Float32Cpu::NegativeZero());
+    ASSERT_FALSE(Float32Cpu::QuietNaN() == Float32Cpu::QuietNaN());
+}
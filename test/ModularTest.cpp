@@ -0,0 +1,133 @@
+//
+// Created by Lumi on 26. 10. 17.
+//
+#include <gtest/gtest.h>
+#include <core/modular/BarrettReducer.h>
+#include <core/modular/MontgomeryContext.h>
+#include <core/dynamic-unsigned-int/DynamicUnsignedInt.h>
+#include <storage/cpu-storage/CPUStorage.h>
+#include <vector>
+
+namespace {
+    // (a * b) mod n through double-width dynamic arithmetic, as an independent reference
+    template<typename UInt>
+    std::string ReferenceModMul(const UInt& a, const UInt& b, const UInt& n) {
+        const size_t wide = 2 * UInt::GetBitSize();
+        return (DynamicUnsignedInt(a).Resized(wide) * DynamicUnsignedInt(b).Resized(wide) % DynamicUnsignedInt(n).Resized(wide)).ToString();
+    }
+}
+
+TEST(MontgomeryContextTest, SmallModulus) {
+    using UInt64 = ArbitraryUnsignedInt<64, 0, CPUStorageProvider>;
+    const uint64_t n = 1000003;
+    MontgomeryContext<64> context{UInt64(n)};
+
+    uint64_t expected = 1;
+    for (int i = 0; i < 200; ++i) {
+        expected = expected * 3 % n;
+    }
+    ASSERT_EQ(context.ModPow(UInt64(3), UInt64(200)).ToString(), std::to_string(expected));
+    ASSERT_EQ(context.ModPow(UInt64(3), UInt64(0)).ToString(), "1");
+    ASSERT_EQ(context.ModMul(UInt64(999999), UInt64(123456789)).ToString(), std::to_string(999999 * (123456789 % n) % n));
+    ASSERT_EQ(MontgomeryContext<64>(UInt64(1)).ModPow(UInt64(5), UInt64(3)).ToString(), "0");
+
+    ASSERT_THROW(MontgomeryContext<64>(UInt64(1000)), std::invalid_argument);
+}
+
+TEST(MontgomeryContextTest, FermatLittleTheorem) {
+    // 2^127 - 1 is prime, so a^(p - 1) == 1 and a^p == a
+    using UInt136 = ArbitraryUnsignedInt<136, 3, CPUStorageProvider>;
+    UInt136 p(1);
+    p <<= 127;
+    p -= UInt136(1);
+    const MontgomeryContext<136> context(p);
+
+    const UInt136 a("98765432109876543210987654321");
+    ASSERT_EQ(context.ModPow(a, p - UInt136(1)).ToString(), "1");
+    ASSERT_EQ(context.ModPow(a, p).ToString(), a.ToString());
+    ASSERT_EQ(context.ModMul(a, a).ToString(), ReferenceModMul(a, a, p));
+}
+
+TEST(MontgomeryContextTest, Modulus2048) {
+    using UInt2048 = ArbitraryUnsignedInt<2048, 0, CPUStorageProvider>;
+    using UInt1024 = ArbitraryUnsignedInt<1024, 0, CPUStorageProvider>;
+
+    UInt2048 n = UInt2048::Max() / UInt2048(3); // 0x5555...5, odd
+    UInt2048 a = UInt2048::Max() / UInt2048(7);
+    UInt2048 b("1234567890123456789012345678901234567890123456789012345678901234567890");
+    const MontgomeryContext<2048> context(n);
+
+    ASSERT_EQ(context.ModMul(a, b).ToString(), ReferenceModMul(a, b, n));
+
+    // a^(e + f) == a^e * a^f, with exponents of another width than the modulus
+    const UInt1024 e = UInt1024::Max() / UInt1024(11);
+    const UInt1024 f("31415926535897932384626433832795028841971693993751");
+    const UInt2048 sum = context.ModPow(a, e + f);
+    const UInt2048 product = context.ModMul(context.ModPow(a, e), context.ModPow(a, f));
+    ASSERT_TRUE(sum == product);
+
+    // The constant-time forms agree with the sliding window
+    ASSERT_TRUE(context.ModPowConstantTime(a, e) == context.ModPow(a, e));
+    ASSERT_TRUE(context.ModPowLadder(a, f) == context.ModPow(a, f));
+    using SecretUInt2048 = ArbitraryUnsignedInt<2048, 0, CPUConstantTimeStorageProvider>;
+    const SecretUInt2048 secretA = SecretUInt2048::Max() / SecretUInt2048(7);
+    ASSERT_EQ(context.ModPow(secretA, f).ToString(), context.ModPow(a, f).ToString());
+
+    // a^2 by exponentiation matches a * a
+    ASSERT_EQ(context.ModPow(a, UInt1024(2)).ToString(), ReferenceModMul(a, a, n));
+    ASSERT_EQ(ModPow(a, UInt1024(2), n).ToString(), ReferenceModMul(a, a, n));
+}
+
+TEST(BarrettReducerTest, MatchesRemainder) {
+    using UInt512 = ArbitraryUnsignedInt<512, 0, CPUStorageProvider>;
+
+    std::vector<UInt512> values = {
+        UInt512(0),
+        UInt512(12345),
+        UInt512::Max(),
+        UInt512::Max() / UInt512(3),
+        UInt512("123456789012345678901234567890123456789012345678901234567890"),
+    };
+    // Full width, half width, a lone limb, an exact limb boundary and tiny moduli
+    std::vector<UInt512> moduli = {
+        UInt512::Max(),
+        UInt512::Max() / UInt512(5),
+        (UInt512(1) << 256) - UInt512(189),
+        UInt512(1) << 128,
+        UInt512(0xFFFFFFFFFFFFFFC5ULL),
+        UInt512(7),
+        UInt512(1),
+    };
+    for (const UInt512& modulus : moduli) {
+        const BarrettReducer<512> reducer(modulus);
+        for (const UInt512& value : values) {
+            ASSERT_EQ(reducer.Reduce(value).ToString(), (value % modulus).ToString());
+        }
+    }
+    ASSERT_THROW(BarrettReducer<512>(UInt512(0)), std::runtime_error);
+}
+
+TEST(BarrettReducerTest, BatchReduce) {
+    using UInt136 = ArbitraryUnsignedInt<136, 2, CPUStorageProvider>;
+    const UInt136 modulus("1000000000000000000000007");
+    const BarrettReducer<136> reducer(modulus);
+
+    std::vector<UInt136> values;
+    UInt136 value = UInt136::Max();
+    for (int i = 0; i < 16; ++i) {
+        values.push_back(value);
+        value = value / UInt136(3) + UInt136(i);
+    }
+    std::vector<UInt136> reduced(values.size());
+    reducer.Reduce(std::span<const UInt136>(values), std::span<UInt136>(reduced));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(reduced[i].ToString(), (values[i] % modulus).ToString());
+    }
+
+    // In place
+    reducer.Reduce(std::span<const UInt136>(values), std::span<UInt136>(values));
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_TRUE(values[i] == reduced[i]);
+    }
+    ASSERT_THROW(reducer.Reduce(std::span<const UInt136>(values), std::span<UInt136>(reduced).first(3)), std::invalid_argument);
+}
@@ -22,3 +22,90 @@ TEST(ArbitrarySignedIntTest, BasicConstruction) {
     ArbitrarySignedInt<64, 0, CPUStorageProvider> d("12345");
     ASSERT_EQ(d, 12345);
 }
+
+TEST(ArbitrarySignedIntTest, Arithmetics) {
+    using Int128 = ArbitrarySignedInt<128, 0, CPUStorageProvider>;
+    Int128 a(-7);
+    Int128 b(2);
+    ASSERT_EQ((a + b).ToString(), "-5");
+    ASSERT_EQ((b - a).ToString(), "9");
+    ASSERT_EQ((a - b).ToString(), "-9");
+    ASSERT_EQ((a * b).ToString(), "-14");
+    ASSERT_EQ((a * a).ToString(), "49");
+    ASSERT_EQ((-a).ToString(), "7");
+
+    // Division truncates toward zero; the remainder follows the dividend
+    ASSERT_EQ((a / b).ToString(), "-3");
+    ASSERT_EQ((a % b).ToString(), "-1");
+    ASSERT_EQ((Int128(7) / Int128(-2)).ToString(), "-3");
+    ASSERT_EQ((Int128(7) % Int128(-2)).ToString(), "1");
+    ASSERT_EQ((a / Int128(-2)).ToString(), "3");
+    ASSERT_THROW(a / Int128(0), std::runtime_error);
+
+    // Accumulating across the 64-bit limb boundary
+    Int128 acc("-18446744073709551616");
+    acc += Int128(1);
+    ASSERT_EQ(acc.ToString(), "-18446744073709551615");
+    acc *= Int128(-3);
+    ASSERT_EQ(acc.ToString(), "55340232221128654845");
+    acc -= Int128("55340232221128654846");
+    ASSERT_EQ(acc, -1);
+
+    // Two's complement wrap-around at the type boundary
+    ASSERT_EQ(Int128::Max().ToString(), "170141183460469231731687303715884105727");
+    ASSERT_EQ(Int128::Min().ToString(), "-170141183460469231731687303715884105728");
+    ASSERT_EQ(Int128::Max() + Int128(1), Int128::Min());
+    ASSERT_EQ(WideningMul(Int128::Min(), Int128(-1)).ToString(), "170141183460469231731687303715884105728");
+    ASSERT_EQ(WideningMul(Int128::Min(), Int128::Max()).ToString(), "-28948022309329048855892746252171976963147354982949671778132708698262398304256");
+}
+
+TEST(ArbitrarySignedIntTest, ArithmeticsWithOffset) {
+    using Int20 = ArbitrarySignedInt<20, 5, CPUStorageProvider>;
+    Int20 a(-300);
+    Int20 b(17);
+    ASSERT_EQ((a * b).ToString(), "-5100");
+    ASSERT_EQ((a / b).ToString(), "-17");
+    ASSERT_EQ((a % b).ToString(), "-11");
+    ASSERT_EQ((a + b).ToString(), "-283");
+    ASSERT_EQ(Int20("-524288").ToString(), "-524288");
+}
+
+TEST(ArbitrarySignedIntTest, ComparisonOperators) {
+    using Int128 = ArbitrarySignedInt<128, 0, CPUStorageProvider>;
+    Int128 a(-5);
+    Int128 b(3);
+    Int128 c("-18446744073709551616");
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(c < a);
+    ASSERT_TRUE(b > c);
+    ASSERT_TRUE(a <= a);
+    ASSERT_TRUE(a >= c);
+    ASSERT_EQ(a <=> Int128(-5), std::strong_ordering::equal);
+    ASSERT_TRUE(Int128::Min() < Int128::Max());
+    ASSERT_TRUE(Int128::Min() < c);
+
+    using Int20 = ArbitrarySignedInt<20, 5, CPUStorageProvider>;
+    ASSERT_TRUE(Int20(-1) < Int20(0));
+    ASSERT_TRUE(Int20(-524288) < Int20(-524287));
+    ASSERT_TRUE(Int20(524287) > Int20(-1));
+}
+
+TEST(ArbitrarySignedIntTest, ArithmeticShift) {
+    using Int100 = ArbitrarySignedInt<100, 3, CPUStorageProvider>;
+    Int100 a(-1000);
+    ASSERT_EQ((a >> 3).ToString(), "-125");
+    ASSERT_EQ((a >> 200).ToString(), "-1");
+    ASSERT_EQ((a << 90).ToString(), "29710560942849126597578981376");
+    ASSERT_EQ((Int100(1000) >> 3).ToString(), "125");
+}
+
+TEST(ArbitrarySignedIntTest, HashIgnoresNeighbouringBits) {
+    using Int100 = ArbitrarySignedInt<100, 3, CPUStorageProvider>;
+    Int100 clean(-42);
+    Int100 dirty(-42);
+    dirty.GetStorage().SetBit(1);
+    dirty.GetStorage().ClearBit(103);
+    ASSERT_TRUE(clean == dirty);
+    ASSERT_EQ(std::hash<Int100>{}(clean), std::hash<Int100>{}(dirty));
+    ASSERT_NE(std::hash<Int100>{}(clean), std::hash<Int100>{}(Int100(42)));
+}
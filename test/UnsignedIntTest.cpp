@@ -3,8 +3,10 @@
 //
 #include <gtest/gtest.h>
 #include <core/unsigned-int/ArbitraryUnsignedInt.h>
+#include <core/unsigned-int/ArbitraryUnsignedIntExpression.h>
 #include <storage/cpu-storage/CPUStorage.h>
 #include <array>
+#include <unordered_set>
 
 class ArbitraryUnsignedIntTest : public ::testing::Test {
 protected:
@@ -291,6 +293,181 @@ TEST(ArbitraryUnsignedIntTest, WideningMultiplication) {
     ASSERT_EQ(result3.GetStorage()[15], 0xFF); // MSB
 }
 
+TEST(ArbitraryUnsignedIntTest, MultiplicationTiers) {
+    // Schoolbook (256 bits), Karatsuba (2048 bits) and Toom-3 (8192 bits) against a reference product
+    auto check = []<size_t BitSize>() {
+        using UInt = ArbitraryUnsignedInt<BitSize, 0, CPUStorageProvider>;
+        constexpr size_t n = UInt::LimbCount;
+        uint64_t state = 0x9E3779B97F4A7C15ULL * BitSize;
+        auto next = [&state]() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        };
+
+        typename UInt::LimbArray x, y;
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = next();
+            y[i] = i % 5 == 0 ? ~0ULL : next();
+        }
+        UInt a, b;
+        a.FromLimbs(x.data());
+        b.FromLimbs(y.data());
+
+        std::array<Limb, 2 * n> expected;
+        LimbMulSchoolbook(expected.data(), x.data(), n, y.data(), n);
+
+        const auto wrapped = (a * b).ToLimbs();
+        ASSERT_TRUE(std::equal(wrapped.begin(), wrapped.end(), expected.begin()));
+        const auto widened = WideningMul(a, b).ToLimbs();
+        ASSERT_TRUE(std::equal(widened.begin(), widened.end(), expected.begin()));
+    };
+    check.template operator()<256>();
+    check.template operator()<2048>();
+    check.template operator()<8192>();
+
+    // (2^N - 1)^2 = 2^2N - 2^(N+1) + 1
+    using UInt4096 = ArbitraryUnsignedInt<4096, 0, CPUStorageProvider>;
+    UInt4096 max = UInt4096::Max();
+    auto square = WideningMul(max, max);
+    ASSERT_TRUE(square.GetBit(0));
+    for (size_t i = 1; i <= 4096; ++i) {
+        ASSERT_FALSE(square.GetBit(i));
+    }
+    for (size_t i = 4097; i < 8192; ++i) {
+        ASSERT_TRUE(square.GetBit(i));
+    }
+    ASSERT_EQ((max * max).ToString(), "1");
+}
+
+TEST(ArbitraryUnsignedIntTest, LongDivision) {
+    using UInt4096 = ArbitraryUnsignedInt<4096, 0, CPUStorageProvider>;
+    constexpr size_t n = UInt4096::LimbCount;
+    uint64_t state = 0xD1B54A32D192ED03ULL;
+    auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+
+    // 4096-bit dividend by a 2048-bit divisor: q * d + r == a and r < d
+    UInt4096::LimbArray x{}, y{};
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = next();
+    }
+    for (size_t i = 0; i < n / 2; ++i) {
+        y[i] = i % 7 == 0 ? ~0ULL : next();
+    }
+    UInt4096 a, d;
+    a.FromLimbs(x.data());
+    d.FromLimbs(y.data());
+
+    auto [q, r] = a.DivRem(d);
+    ASSERT_TRUE(r < d);
+    ASSERT_TRUE(q * d + r == a);
+    ASSERT_TRUE(a / d == q);
+    ASSERT_TRUE(a % d == r);
+
+    // Single-limb divisor
+    UInt4096 ten(10ULL);
+    auto [q10, r10] = a.DivRem(ten);
+    ASSERT_TRUE(r10 < ten);
+    ASSERT_TRUE(q10 * ten + r10 == a);
+
+    // Max / Max and division by zero
+    UInt4096 max = UInt4096::Max();
+    ASSERT_EQ((max / max).ToString(), "1");
+    ASSERT_EQ((max % max).ToString(), "0");
+    ASSERT_THROW(a / UInt4096(), std::runtime_error);
+}
+
+TEST(ArbitraryUnsignedIntTest, GcdAndModInverse) {
+    // Binary GCD (192 bits) and Lehmer (2048 bits) against Euclid's algorithm, with a shared factor
+    auto check = []<size_t BitSize>() {
+        using UInt = ArbitraryUnsignedInt<BitSize, 0, CPUStorageProvider>;
+        constexpr size_t n = UInt::LimbCount;
+        uint64_t state = 0x2545F4914F6CDD1DULL * BitSize;
+        auto next = [&state]() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        };
+        auto euclid = [](UInt a, UInt b) {
+            while (!b.IsZero()) {
+                UInt r = a % b;
+                a = b;
+                b = r;
+            }
+            return a;
+        };
+
+        for (int round = 0; round < 8; ++round) {
+            typename UInt::LimbArray x{}, y{}, z{};
+            for (size_t i = 0; i < n / 2; ++i) {
+                x[i] = next();
+                y[i] = round % 4 == 3 && i > 0 ? 0 : next();
+            }
+            for (size_t i = 0; i < n / 4 + 1; ++i) {
+                z[i] = next();
+            }
+            UInt a, b, factor;
+            a.FromLimbs(x.data());
+            b.FromLimbs(y.data());
+            factor.FromLimbs(z.data());
+            a = a * factor << (round * 9);
+            b = b * factor << (round * 5);
+
+            const UInt g = Gcd(a, b);
+            ASSERT_TRUE(g == euclid(a, b));
+            ASSERT_TRUE((a % g).IsZero() && (b % g).IsZero());
+            ASSERT_TRUE(Lcm(a, b) == a / g * b);
+
+            const auto [eg, ex, ey] = ExtendedGcd(a, b);
+            ASSERT_TRUE(eg == g);
+            ASSERT_TRUE(a * ex + b * ey == g);
+        }
+
+        // Consecutive Fibonacci numbers drive every quotient to 1, the longest Euclidean sequence
+        UInt previous(1), current(1);
+        while (!(current > UInt::Max() / UInt(2))) {
+            UInt following = previous + current;
+            previous = current;
+            current = following;
+        }
+        ASSERT_EQ(Gcd(current, previous).ToString(), "1");
+        const auto [fg, fx, fy] = ExtendedGcd(current, previous);
+        ASSERT_EQ(fg.ToString(), "1");
+        ASSERT_TRUE(current * fx + previous * fy == UInt(1));
+        const UInt inverse = ModInverse(previous, current);
+        ASSERT_TRUE(inverse < current);
+        ASSERT_EQ(ModInverse(inverse, current).ToString(), previous.ToString());
+    };
+    check.template operator()<192>();
+    check.template operator()<2048>();
+
+    using UInt64 = ArbitraryUnsignedInt<64, 0, CPUStorageProvider>;
+    ASSERT_EQ(Gcd(UInt64(48), UInt64(180)).ToString(), "12");
+    ASSERT_EQ(Gcd(UInt64(0), UInt64(7)).ToString(), "7");
+    ASSERT_EQ(Gcd(UInt64(0), UInt64(0)).ToString(), "0");
+    ASSERT_EQ(Lcm(UInt64(4), UInt64(6)).ToString(), "12");
+    ASSERT_EQ(Lcm(UInt64(0), UInt64(6)).ToString(), "0");
+
+    // 240 * -9 + 46 * 47 = 2, with the sign of x in its top bit
+    const auto [g, x, y] = ExtendedGcd(UInt64(240), UInt64(46));
+    ASSERT_EQ(g.ToString(), "2");
+    ASSERT_EQ((UInt64(0) - x).ToString(), "9");
+    ASSERT_EQ(y.ToString(), "47");
+
+    ASSERT_EQ(ModInverse(UInt64(3), UInt64(11)).ToString(), "4");
+    ASSERT_EQ(ModInverse(UInt64(65537), UInt64(3120)).ToString(), "2753");
+    ASSERT_EQ(ModInverse(UInt64(5), UInt64(1)).ToString(), "0");
+    ASSERT_THROW(ModInverse(UInt64(6), UInt64(9)), std::invalid_argument);
+    ASSERT_THROW(ModInverse(UInt64(6), UInt64(0)), std::runtime_error);
+}
+
 TEST(ArbitraryUnsignedIntTest, ToStringTest) {
     using UInt8 = ArbitraryUnsignedInt<8, 0, CPUStorageProvider>;
     using UInt16 = ArbitraryUnsignedInt<16, 0, CPUStorageProvider>;
@@ -314,6 +491,56 @@ TEST(ArbitraryUnsignedIntTest, ToStringTest) {
     ASSERT_EQ(f.ToString(), "1234567890987654321234567890987654321012345678909876543210123456");
 }
 
+TEST(ArbitraryUnsignedIntTest, RadixConversion) {
+    // 16384 bits goes through the divide-and-conquer paths in both directions
+    using UInt16384 = ArbitraryUnsignedInt<16384, 0, CPUStorageProvider>;
+    const std::string power = "1" + std::string(4000, '0');
+    UInt16384 a(power);
+    ASSERT_EQ(a.ToString(), power);
+
+    UInt16384::LimbArray limbs;
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    for (auto& limb : limbs) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        limb = state;
+    }
+    UInt16384 b;
+    b.FromLimbs(limbs.data());
+    for (int base : { 10, 7, 36 }) {
+        ASSERT_TRUE(UInt16384(b.ToString(base), base) == b);
+    }
+    ASSERT_EQ(UInt16384::Max().ToString(16), std::string(4096, 'F'));
+
+    // Parsing wraps modulo 2^BitSize and rejects digits outside the base
+    using UInt8 = ArbitraryUnsignedInt<8, 0, CPUStorageProvider>;
+    ASSERT_EQ(UInt8("300").ToString(), "44");
+    ASSERT_THROW(UInt8("12a"), std::invalid_argument);
+    ASSERT_THROW(UInt8("19", 8), std::invalid_argument);
+}
+
+TEST(ArbitraryUnsignedIntTest, PowerOfTwoBases) {
+    using UInt256 = ArbitraryUnsignedInt<256, 0, CPUStorageProvider>;
+    const std::string hash = "9F86D081884C7D659A2FEAA0C55AD015A3BF4F1B2B0B822CD15D6C15B0F00A08";
+    UInt256 a(hash, 16);
+    ASSERT_EQ(a.ToHexString(), hash);
+    ASSERT_TRUE(UInt256("9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08", 16) == a);
+    ASSERT_TRUE(UInt256(a.ToString(2), 2) == a);
+    ASSERT_TRUE(UInt256(a.ToString(8), 8) == a);
+    ASSERT_TRUE(UInt256(a.ToString(32), 32) == a);
+    ASSERT_EQ(a.ToString(16), hash);
+    ASSERT_THROW(UInt256("9G", 16), std::invalid_argument);
+
+    // Fixed-width output, and a width and offset that are not multiples of a nibble
+    using UInt20 = ArbitraryUnsignedInt<20, 3, CPUStorageProvider>;
+    UInt20 b(0x5A3C1);
+    ASSERT_EQ(b.ToHexString(), "5A3C1");
+    ASSERT_EQ(b.ToBinaryString(), "01011010001111000001");
+    ASSERT_EQ(UInt20("777", 8).ToString(), "511");
+    ASSERT_EQ(UInt256(1).ToHexString(), std::string(63, '0') + "1");
+}
+
 TEST(ArbitraryUnsignedIntTest, ComparisonOperators) {
     using UInt8 = ArbitraryUnsignedInt<8, 0, CPUStorageProvider>;
 
@@ -372,3 +599,237 @@ TEST(ArbitraryUnsignedIntTest, ComparisonOperators) {
     ASSERT_FALSE(max_val < max_minus_one);
     ASSERT_FALSE(max_val <= max_minus_one);
 }
+
+TEST(ArbitraryUnsignedIntTest, ComparisonAcrossLimbs) {
+    // Unaligned offset and width: the value spans storage bits 3..102
+    using UInt100 = ArbitraryUnsignedInt<100, 3, CPUStorageProvider>;
+    UInt100 a("1000000000000000000000000000");
+    UInt100 b("1000000000000000000000000001");
+    UInt100 c("999999999999999999999999999");
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(c < a);
+    ASSERT_TRUE(b >= a);
+    ASSERT_EQ(a <=> a, std::strong_ordering::equal);
+    ASSERT_EQ(b <=> c, std::strong_ordering::greater);
+    ASSERT_TRUE(UInt100::Max() > b);
+
+    // Bits sharing the storage outside the value do not take part
+    UInt100 d = a;
+    d.GetStorage().SetBit(0);
+    d.GetStorage().SetBit(103);
+    ASSERT_TRUE(d == a);
+    ASSERT_EQ(d <=> a, std::strong_ordering::equal);
+    ASSERT_FALSE(d.IsZero());
+    UInt100 zero;
+    zero.GetStorage().SetBit(2);
+    ASSERT_TRUE(zero.IsZero());
+
+    // Byte-aligned equality with a partial tail byte
+    using UInt20 = ArbitraryUnsignedInt<20, 8, CPUStorageProvider>;
+    UInt20 e(0xABCDE);
+    UInt20 f(0xABCDE);
+    f.GetStorage().SetBit(30);
+    ASSERT_TRUE(e == f);
+    ASSERT_TRUE(e != UInt20(0xABCDF));
+}
+
+TEST(ArbitraryUnsignedIntTest, ShiftsAndRotatesWithOffset) {
+    // Shifts stay inside [BitOffset, BitOffset + BitSize) and leave the neighbouring bits alone
+    using UInt70 = ArbitraryUnsignedInt<70, 5, CPUStorageProvider>;
+    UInt70 a("1180591620717411303423"); // 2^70 - 1
+    a.GetStorage().SetBit(0);
+    ASSERT_EQ((a << 3).ToString(), "1180591620717411303416");
+    ASSERT_EQ((a >> 69).ToString(), "1");
+    ASSERT_TRUE((a << 3).GetStorage().GetBit(0));
+    ASSERT_FALSE((a << 3).GetStorage().GetBit(75));
+
+    UInt70 b(1);
+    ASSERT_EQ(b.RotateRight(1).ToString(), "590295810358705651712"); // 2^69
+    ASSERT_EQ(b.RotateRight(1).RotateLeft(2).ToString(), "2");
+    ASSERT_TRUE(b.RotateLeft(70) == b);
+    ASSERT_EQ(b.ReverseBits().ToString(), "590295810358705651712");
+    ASSERT_TRUE(a.ReverseBits().GetStorage().GetBit(0));
+    ASSERT_TRUE(a.ReverseBits().ReverseBits() == a);
+}
+
+TEST(ArbitraryUnsignedIntTest, HashedKeys) {
+    using UInt256 = ArbitraryUnsignedInt<256, 0, CPUStorageProvider>;
+    std::unordered_set<UInt256> keys;
+    for (int i = 0; i < 1000; ++i) {
+        keys.insert(UInt256(i) * UInt256("1000000000000000000000000000000"));
+    }
+    ASSERT_EQ(keys.size(), 1000u);
+    ASSERT_TRUE(keys.contains(UInt256(999) * UInt256("1000000000000000000000000000000")));
+    ASSERT_FALSE(keys.contains(UInt256(1000)));
+    ASSERT_EQ(std::hash<UInt256>{}(UInt256(42)), std::hash<UInt256>{}(UInt256("42")));
+
+    // Bits around an offset value never reach the hash
+    using UInt70 = ArbitraryUnsignedInt<70, 5, CPUStorageProvider>;
+    UInt70 clean(123456789);
+    UInt70 dirty(123456789);
+    dirty.GetStorage().SetBitRange(0, 5);
+    dirty.GetStorage().SetBit(77);
+    ASSERT_TRUE(clean == dirty);
+    ASSERT_EQ(std::hash<UInt70>{}(clean), std::hash<UInt70>{}(dirty));
+    ASSERT_EQ(std::hash<UInt70>{}(dirty), (std::hash<ArbitraryUnsignedInt<70, 0, CPUStorageProvider>>{}(ArbitraryUnsignedInt<70, 0, CPUStorageProvider>(123456789))));
+    ASSERT_NE(std::hash<UInt70>{}(clean), std::hash<UInt70>{}(UInt70(123456788)));
+}
+
+TEST(ArbitraryUnsignedIntTest, LimbStorageProvider) {
+    using UInt256 = ArbitraryUnsignedInt<256, 0, CPULimbStorageProvider>;
+    UInt256 a(std::string("115792089237316195423570985008687907853269984665640564039457584007913129639935")); // 2^256 - 1
+    UInt256 b(1);
+    a += b;
+    ASSERT_EQ(a.ToString(), "0");
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(a.GetStorage().Data()) % 64, 0u);
+
+    UInt256 c(1000);
+    UInt256 d(24);
+    ASSERT_EQ((c * d).ToString(), "24000");
+    ASSERT_TRUE(UInt256(3) < UInt256(4));
+}
+
+TEST(ArbitraryUnsignedIntTest, HeapStorageProvider) {
+    // A 65536-bit value is a pointer on the stack
+    using UInt65536 = ArbitraryUnsignedInt<65536, 0, CPUHeapStorageProvider<>>;
+    static_assert(sizeof(UInt65536) < 64);
+
+    UInt65536 a(1);
+    a <<= 65000;
+    UInt65536 b = a;
+    b -= UInt65536(1);
+    ASSERT_EQ(b.GetStorage().PopCount(), 65000u);
+    b += UInt65536(1);
+    ASSERT_TRUE(b == a);
+    ASSERT_TRUE(a / (a >> 64000) == a >> 1000);
+    ASSERT_EQ((a >> 64000).ToString(), "10715086071862673209484250490600018105614048117055336074437503883703510511249361224931983788156958581275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954182153046474983581941267398767559165543946077062914571196477686542167660429831652624386837205668069376");
+    const uint8_t* before = a.GetStorage().Data();
+    UInt65536 c = std::move(a);
+    ASSERT_EQ(c.GetStorage().Data(), before);
+}
+
+TEST(ArbitraryUnsignedIntTest, ExpressionTemplates) {
+    // Offset values take the row-by-row multiply-accumulate, 4096-bit ones the Karatsuba one
+    using UInt250 = ArbitraryUnsignedInt<250, 3, CPUStorageProvider>;
+    using UInt4096 = ArbitraryUnsignedInt<4096, 0, CPUStorageProvider>;
+
+    UInt250 a("123456789012345678901234567890123456789");
+    UInt250 b("987654321098765432109876543210");
+    UInt250 c = UInt250::Max();
+    UInt250 d(0xdeadbeefULL);
+    UInt250 e("55555555555555555555555555555555555555555555555555");
+
+    // Reference values from the plain operators
+    UInt250 expected = a * b;
+    expected += c * d;
+    expected -= e >> 3;
+    UInt250 fused = Lazy(a) * b + Lazy(c) * d - (Lazy(e) >> 3);
+    ASSERT_TRUE(fused == expected);
+
+    UInt250 mixed = (((Lazy(a) << 70) ^ b) & ~Lazy(c >> 5)) | d;
+    auto referenceLimbs = (a << 70).ToLimbs();
+    const auto bLimbs = b.ToLimbs();
+    const auto cLimbs = (c >> 5).ToLimbs();
+    const auto dLimbs = d.ToLimbs();
+    for (size_t i = 0; i < UInt250::LimbCount; ++i) {
+        referenceLimbs[i] = ((referenceLimbs[i] ^ bLimbs[i]) & ~cLimbs[i]) | dLimbs[i];
+    }
+    UInt250 reference;
+    reference.FromLimbs(referenceLimbs.data());
+    ASSERT_TRUE(mixed == reference);
+
+    // Wrap-around, and the carry out of the skipped limbs still reaches the shifted result
+    UInt250 wrapped = Lazy(c) + UInt250(1);
+    ASSERT_TRUE(wrapped.IsZero());
+    UInt250 carried = (Lazy(c) - UInt250::Max() + UInt250::Max()) >> 200;
+    ASSERT_TRUE(carried == c >> 200);
+
+    // The target may appear in its own expression
+    UInt250 shifted = a;
+    (Lazy(shifted) << 130 | shifted).EvaluateInto(shifted);
+    UInt250 shiftedReference = a << 130;
+    shiftedReference += a; // a has fewer than 130 bits, so | and + agree
+    ASSERT_TRUE(shifted == shiftedReference);
+
+    UInt4096 x = UInt4096::Max();
+    x >>= 7;
+    UInt4096 y("31415926535897932384626433832795028841971693993751058209749445923078164062862");
+    UInt4096 z(12345);
+    UInt4096 bigExpected = x * y;
+    bigExpected = UInt4096(z) - bigExpected;
+    UInt4096 bigFused = Lazy(z) - x * y;
+    ASSERT_TRUE(bigFused == bigExpected);
+}
+
+TEST(ArbitraryUnsignedIntTest, BinaryOperatorsLeaveOperandsAlone) {
+    using UInt200 = ArbitraryUnsignedInt<200, 5, CPUStorageProvider>;
+    const UInt200 a("1000000000000000000000000000000");
+    const UInt200 b(12345);
+
+    ASSERT_EQ((a + b).ToString(), "1000000000000000000000000012345");
+    ASSERT_EQ((a - b).ToString(), "999999999999999999999999987655");
+    ASSERT_EQ((b - a + a).ToString(), "12345");
+    ASSERT_EQ((a & b).ToString(), (b & a).ToString());
+    ASSERT_EQ((~UInt200(0)).ToString(), UInt200::Max().ToString());
+    ASSERT_EQ(a.ToString(), "1000000000000000000000000000000");
+    ASSERT_EQ(b.ToString(), "12345");
+
+    // Temporaries on either side give the same values
+    ASSERT_EQ((UInt200(a) + UInt200(b)).ToString(), (a + b).ToString());
+    ASSERT_EQ((a + UInt200(b)).ToString(), (a + b).ToString());
+    ASSERT_EQ((UInt200(a) - b).ToString(), (a - b).ToString());
+    ASSERT_EQ((UInt200(a) * b).ToString(), (a * b).ToString());
+    ASSERT_EQ((UInt200(a) ^ b ^ b).ToString(), a.ToString());
+
+    // A dying heap-backed operand hands its block to the result
+    using UInt8192 = ArbitraryUnsignedInt<8192, 0, CPUHeapStorageProvider<>>;
+    static_assert(std::is_nothrow_move_constructible_v<UInt8192>);
+    UInt8192 x(7);
+    const UInt8192 y(5);
+    const uint8_t* block = x.GetStorage().Data();
+    UInt8192 sum = std::move(x) + y;
+    ASSERT_EQ(sum.GetStorage().Data(), block);
+    ASSERT_EQ(sum.ToString(), "12");
+    UInt8192 sum2 = y + std::move(sum);
+    ASSERT_EQ(sum2.GetStorage().Data(), block);
+    ASSERT_EQ(sum2.ToString(), "17");
+
+    // An accumulation loop keeps working in the same block, and a given-away operand can be reassigned
+    UInt8192 total(1);
+    const uint8_t* totalBlock = total.GetStorage().Data();
+    for (int i = 0; i < 100; ++i) {
+        total = std::move(total) + y;
+    }
+    ASSERT_EQ(total.GetStorage().Data(), totalBlock);
+    ASSERT_EQ(total.ToString(), "501");
+    x = y * UInt8192(3);
+    ASSERT_EQ(x.ToString(), "15");
+}
+
+TEST(ArbitraryUnsignedIntTest, ConstantTimeProvider) {
+    using SecretUInt = ArbitraryUnsignedInt<320, 0, CPUConstantTimeStorageProvider>;
+    using PublicUInt = ArbitraryUnsignedInt<320, 0, CPUStorageProvider>;
+    static_assert(SecretUInt::IsConstantTime);
+    static_assert(!PublicUInt::IsConstantTime);
+
+    const std::string x = "1234567890123456789012345678901234567890123456789";
+    const std::string y = "98765432109876543210987654321";
+    const SecretUInt a(x), b(y);
+    const PublicUInt pa(x), pb(y);
+
+    ASSERT_EQ((a * b).ToString(), (pa * pb).ToString());
+    ASSERT_EQ((a + b).ToString(), (pa + pb).ToString());
+    ASSERT_EQ((a - b).ToString(), (pa - pb).ToString());
+    ASSERT_EQ(b.Pow(7).ToString(), pb.Pow(7).ToString());
+    ASSERT_TRUE(a > b && b < a && a != b && a == SecretUInt(x));
+    ASSERT_TRUE((a <=> a) == std::strong_ordering::equal);
+    ASSERT_TRUE(SecretUInt(0).IsZero() && !a.IsZero());
+
+    ASSERT_TRUE(ConditionalSelect(true, a, b) == a);
+    ASSERT_TRUE(ConditionalSelect(false, a, b) == b);
+    SecretUInt c = a, d = b;
+    ConditionalSwap(false, c, d);
+    ASSERT_TRUE(c == a && d == b);
+    ConditionalSwap(true, c, d);
+    ASSERT_TRUE(c == b && d == a);
+}